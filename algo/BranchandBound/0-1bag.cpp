@@ -3,14 +3,20 @@
  * @author LyBin (lybin1336258176@outlook.com)
  * @brief 分支限界法解决0/1背包问题
  *        分支限界法常以广度优先或以最小耗费（最大效益）优先的方式搜索问题的解空间树(子集树、排列树)
- * @version 1.0
- * @date 2024-11-23
+ *        上界按性价比排序后的贪心（分数背包）计算：用重量、价值的前缀和二分查找第一个装不下的物品（临界物品），
+ *        每次 O(logM)；节点中保存临界物品，装入下个物品的子节点临界物品不变，上界与父节点相同，
+ *        不装入的子节点只需从父节点的临界物品往后查找
+ *        s3 为多线程版本，见 ParallelBranchAndBound.hpp
+ *        0-1bag [threads] < input    输入 C M 与M个物品的 重量 价值，threads大于1时使用多线程版本
+ *        0-1bag --bench              比较逐个累加与前缀和二分两种上界的每节点耗时，以及不同线程数的耗时
+ * @version 1.2
+ * @date 2026-10-17
  * 
  * @copyright Copyright (c) 2024
  * 
  */
 
-#include <bits/stdc++.h>
+#include "ParallelBranchAndBound.hpp"
 
 struct Item {
   int value_{};   // 价值
@@ -26,24 +32,68 @@ struct Node {
   int cv_{};        // 当前价值
   int cl_{};        // 当前节点所处的层数，最上层为0
   double bound_{};  // 该节点的上界值
+  int crit_{};      // 临界物品：从第cl_个物品起按顺序装入时第一个装不下的物品，全部装得下时为M
 };
 
 int M{};  // 物品数量
 int C{};  // 背包容量
 std::vector<Item> items{};
 
+std::vector<int64_t> W{};  // W[i] 为前i个物品的重量和
+std::vector<int64_t> V{};  // V[i] 为前i个物品的价值和
+
+/**
+ * @brief 物品按性价比排序后计算重量、价值的前缀和
+ */
+void prepare() {
+  std::sort(items.begin(), items.end(), std::greater<Item>());
+  W.assign(M + 1, 0);
+  V.assign(M + 1, 0);
+  for (int i = 0; i < M; i++) {
+    W[i + 1] = W[i] + items[i].weight_;
+    V[i + 1] = V[i] + items[i].value_;
+  }
+}
+
+/**
+ * @brief 临界物品：从第i个物品起按顺序装入时第一个装不下的物品
+ *
+ * @param i 要装入的物品索引
+ * @param cw 当前重量
+ * @param from 已知不超过结果的位置（不小于i），从这里开始二分
+ * @return int 临界物品的索引，全部装得下时为M
+ */
+int critical(int i, int cw, int from) {
+  return std::upper_bound(W.begin() + from, W.end(), W[i] + C - cw) - W.begin() - 1;
+}
+
 /**
  * @brief 上界函数：用于评估当前节点（部分解）是否有可能得到问题的最优解
+ *        第i ~ k-1个物品全部装入，再装入第k个物品的一部分
  *
  * @param i 要装入的物品索引
  * @param cw 当前重量
  * @param cv 当前价值
+ * @param k 临界物品
  * @return double 上界值
  */
-double bound(int i, int cw, int cv) {
+double bound(int i, int cw, int cv, int k) {
+  double res = cv + (V[k] - V[i]);
+  if (k < M) {
+    res += (C - cw - (W[k] - W[i])) * (items[k].value_ * 1.0 / items[k].weight_);
+  }
+  return res;
+}
+
+double bound(int i, int cw, int cv) { return bound(i, cw, cv, critical(i, cw, i)); }
+
+/**
+ * @brief 逐个累加物品的上界函数，每次 O(M)，用于对照
+ */
+double boundScan(int i, int cw, int cv) {
   double res = cv;
   int left = C - cw;
-  while (items[i].weight_ <= left && i < M) {
+  while (i < M && items[i].weight_ <= left) {
     res += items[i].value_;
     left -= items[i].weight_;
     i++;
@@ -74,26 +124,44 @@ struct compare {
 // 基于节点价值上界比较的优先队列
 std::priority_queue<Node, std::vector<Node>, compare> q{};
 
+long long expanded{};  // 扩展的节点数
+
+/**
+ * @tparam kScan 为true时每个节点用 boundScan 重新计算两个子节点的上界，用于对照
+ */
+template <bool kScan = false>
 int solve() {
   int bestValue{0};
-  q.emplace(0, 0, 0, bound(0, 0, 0));  // 根节点压入队列
+  expanded = 0;
+  q = {};
+  q.emplace(0, 0, 0, bound(0, 0, 0), critical(0, 0, 0));  // 根节点压入队列
   while (!q.empty()) {
     Node node = q.top();
     q.pop();
     if (node.cl_ == M) {  // 叶子节点
       bestValue = std::max(bestValue, node.cv_);
     } else {              // 非叶子节点
-      int nxt_item = node.cl_;                                  // 待装入物品的序号
-      double bound1 = bound(nxt_item, node.cw_, node.cv_);      // 装入下个物品的上界值
-      double bound0 = bound(nxt_item + 1, node.cw_, node.cv_);  // 不装入下个物品的上界值
+      expanded++;
+      int nxt_item = node.cl_;  // 待装入物品的序号
+      double bound1, bound0;    // 装入、不装入下个物品的上界值
+      int crit0{};              // 不装入下个物品时的临界物品
+      if constexpr (kScan) {
+        bound1 = boundScan(nxt_item, node.cw_, node.cv_);
+        bound0 = boundScan(nxt_item + 1, node.cw_, node.cv_);
+      } else {
+        // 装入下个物品不改变临界物品，上界即为当前节点的上界
+        bound1 = node.bound_;
+        crit0 = critical(nxt_item + 1, node.cw_, std::max(node.crit_, nxt_item + 1));
+        bound0 = bound(nxt_item + 1, node.cw_, node.cv_, crit0);
+      }
       // 装入下个物品
       if (constraint(nxt_item, node.cw_) && bound1 > bestValue) {
         q.emplace(node.cw_ + items[nxt_item].weight_, node.cv_ + items[nxt_item].value_,
-                  node.cl_ + 1, bound1);
+                  node.cl_ + 1, bound1, node.crit_);
       }
       // 不装入下个物品
       if (bound0 > bestValue) {
-        q.emplace(node.cw_, node.cv_, node.cl_ + 1, bound0);
+        q.emplace(node.cw_, node.cv_, node.cl_ + 1, bound0, crit0);
       }
     }
   }
@@ -138,13 +206,119 @@ int solve() {
 }
 };
 
-int main() {
+// 多线程的优先队列分支限界法
+namespace s3 {
+
+struct Knapsack {
+  using Node = ::Node;
+  using Value = int;
+  static constexpr bool kMaximize = true;
+
+  inline double bound(const Node& node) const { return node.bound_; }
+
+  inline bool leaf(const Node& node) const { return node.cl_ == M; }
+
+  inline int value(const Node& node) const { return node.cv_; }
+
+  template <typename Push>
+  void branch(const Node& node, const int bestValue, Push&& push) const {
+    int nxt_item = node.cl_;  // 待装入物品的序号
+    int crit0 = critical(nxt_item + 1, node.cw_, std::max(node.crit_, nxt_item + 1));
+    double bound0 = ::bound(nxt_item + 1, node.cw_, node.cv_, crit0);  // 不装入下个物品的上界值
+    // 装入下个物品，上界即为当前节点的上界
+    if (constraint(nxt_item, node.cw_) && node.bound_ > bestValue) {
+      push(Node{node.cw_ + items[nxt_item].weight_, node.cv_ + items[nxt_item].value_, node.cl_ + 1,
+                node.bound_, node.crit_});
+    }
+    // 不装入下个物品
+    if (bound0 > bestValue) {
+      push(Node{node.cw_, node.cv_, node.cl_ + 1, bound0, crit0});
+    }
+  }
+};
+
+long long expanded{};  // 扩展的节点数
+long long steals{};    // 线程间窃取的节点数
+
+int solve(int threads) {
+  Knapsack problem;
+  ParallelBranchAndBound<Knapsack> engine(problem, threads);
+  int bestValue = engine.solve(Node{0, 0, 0, bound(0, 0, 0), critical(0, 0, 0)}, 0);
+  expanded = engine.expanded();
+  steals = engine.steals();
+  return bestValue;
+}
+};  // namespace s3
+
+inline double elapsed(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench() {
+  std::mt19937 gen(20241124);
+  for (const int size : {10000, 30000, 100000}) {
+    // 重量与价值在 1 ~ 1000 内均匀随机，容量为总重量的一半
+    M = size;
+    items.clear();
+    int64_t total = 0;
+    for (int i = 0; i < M; i++) {
+      items.emplace_back(static_cast<int>(gen() % 1000 + 1), static_cast<int>(gen() % 1000 + 1));
+      total += items.back().weight_;
+    }
+    C = static_cast<int>(total / 2);
+    prepare();
+
+    auto start = std::chrono::steady_clock::now();
+    const int best = s1::solve();
+    const double fast = elapsed(start);
+    const long long nodes = s1::expanded;
+    start = std::chrono::steady_clock::now();
+    const int scan = s1::solve<true>();
+    const double slow = elapsed(start);
+    printf("M = %6d: %8lld nodes  scan %9.1f ms (%7.3f us/node)  prefix %7.1f ms (%7.3f us/node)%s\n",
+           M, nodes, slow, slow * 1000 / s1::expanded, fast, fast * 1000 / nodes,
+           best == scan ? "" : "  MISMATCH");
+  }
+
+  // 强相关的实例（价值 = 重量 + 100）上界很紧，需要扩展大量节点
+  for (const int size : {60, 90}) {
+    gen.seed(20241124);
+    M = size;
+    items.clear();
+    int64_t total = 0;
+    for (int i = 0; i < M; i++) {
+      const int w = static_cast<int>(gen() % 1000 + 1);
+      items.emplace_back(w + 100, w);
+      total += w;
+    }
+    C = static_cast<int>(total / 2);
+    prepare();
+
+    auto start = std::chrono::steady_clock::now();
+    const int best = s1::solve();
+    printf("correlated M = %d: serial %9.1f ms %10lld nodes\n", M, elapsed(start), s1::expanded);
+    const int hw = std::max(1u, std::thread::hardware_concurrency());
+    for (int threads = 1; threads <= std::max(4, hw); threads *= 2) {
+      start = std::chrono::steady_clock::now();
+      const int res = s3::solve(threads);
+      printf("  %2d threads      %9.1f ms %10lld nodes %8lld steals%s\n", threads, elapsed(start),
+             s3::expanded, s3::steals, res == best ? "" : "  MISMATCH");
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    bench();
+    return 0;
+  }
   std::cin >> C >> M;
   for (int i = 0; i < M; i++) {
     int w, v;
     std::cin >> w >> v;
     items.emplace_back(v, w);
   }
-  std::sort(items.begin(), items.end(), std::greater<Item>());
-  std::cout << s1::solve() << '\n';
-}
\ No newline at end of file
+  prepare();
+  const int threads = argc > 1 ? std::stoi(argv[1]) : 1;
+  std::cout << (threads > 1 ? s3::solve(threads) : s1::solve()) << '\n';
+}
@@ -0,0 +1,173 @@
+/**
+ * @file ParallelBranchAndBound.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 多线程的最优优先分支限界：每个线程一个按上界（下界）排序的优先队列，自己的队列空了就从其他线程的队列中窃取
+ *        当前最优解 best_ 为所有线程共享的原子变量，任一线程找到更优的解后，其他线程立即用它剪枝
+ *        pending_ 记录队列中与正在扩展的节点总数，子节点先入队再结束父节点，减到0时搜索结束
+ *        剪枝只剪去不可能严格优于当前最优解的节点，所以无论线程怎样交错，最终得到的最优值都相同
+ *
+ *        Problem 需要提供：
+ *          Node、Value                          节点与解的类型
+ *          static constexpr bool kMaximize      求最大值（0/1背包）还是最小值（最短路）
+ *          bound(node)                          节点的上界（求最小值时为下界），同时决定出队顺序
+ *          leaf(node)、value(node)              是否为完整的解及其值
+ *          branch(node, best, push)             扩展节点：对满足约束函数且未被限界剪去的子节点调用 push(child)
+ *        branch 会被多个线程同时调用，Problem中被修改的状态需要自行同步
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <bits/stdc++.h>
+
+template <typename Problem>
+class ParallelBranchAndBound {
+ public:
+  using Node = typename Problem::Node;
+  using Value = typename Problem::Value;
+
+ private:
+  struct alignas(64) Worker {
+    std::mutex lock_;
+    std::vector<Node> heap_;  // 堆顶为上界最优的节点
+    long long expanded_{};    // 扩展的节点数
+    long long steals_{};      // 窃取的节点数
+  };
+
+  Problem& problem_;
+  const int threads_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<Value> best_{};
+  std::atomic<long long> pending_{};
+
+  // a 严格优于 b
+  template <typename A, typename B>
+  static inline bool better(const A& a, const B& b) {
+    if constexpr (Problem::kMaximize) {
+      return a > b;
+    } else {
+      return a < b;
+    }
+  }
+
+  // 堆的比较函数：x 的优先级低于 y
+  inline auto lower() const {
+    return [this](const Node& x, const Node& y) { return better(problem_.bound(y), problem_.bound(x)); };
+  }
+
+  void push(Worker& w, Node node) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> guard(w.lock_);
+    w.heap_.push_back(std::move(node));
+    std::push_heap(w.heap_.begin(), w.heap_.end(), lower());
+  }
+
+  bool pop(Worker& w, Node& node) {
+    std::lock_guard<std::mutex> guard(w.lock_);
+    if (w.heap_.empty()) return false;
+    std::pop_heap(w.heap_.begin(), w.heap_.end(), lower());
+    node = std::move(w.heap_.back());
+    w.heap_.pop_back();
+    return true;
+  }
+
+  // 依次尝试从其他线程的队列中取出堆顶
+  bool steal(const int t, Node& node) {
+    for (int k = 1; k < threads_; k++) {
+      if (pop(*workers_[(t + k) % threads_], node)) {
+        workers_[t]->steals_++;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // 丢弃自己队列中的所有节点
+  void drop(Worker& w) {
+    std::lock_guard<std::mutex> guard(w.lock_);
+    pending_.fetch_sub(w.heap_.size(), std::memory_order_relaxed);
+    w.heap_.clear();
+  }
+
+  void offer(const Value value) {
+    Value cur = best_.load(std::memory_order_relaxed);
+    while (better(value, cur) && !best_.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  void work(const int t) {
+    Worker& w = *workers_[t];
+    const auto push = [this, &w](Node child) { this->push(w, std::move(child)); };
+    Node node{};
+    while (true) {
+      const bool own = pop(w, node);
+      if (!own && !steal(t, node)) {
+        if (pending_.load(std::memory_order_acquire) == 0) return;
+        std::this_thread::yield();
+        continue;
+      }
+      const Value best = best_.load(std::memory_order_relaxed);
+      if (!better(problem_.bound(node), best)) {  // 限界剪枝
+        if (own) drop(w);  // 自己队列中剩余节点的上界都不优于它
+      } else {
+        w.expanded_++;
+        if (problem_.leaf(node)) {
+          offer(problem_.value(node));
+        } else {
+          problem_.branch(node, best, push);
+        }
+      }
+      pending_.fetch_sub(1, std::memory_order_release);
+    }
+  }
+
+ public:
+  /**
+   * @brief 构造
+   *
+   * @param problem 问题，搜索期间需要保持有效
+   * @param threads 线程数
+   */
+  ParallelBranchAndBound(Problem& problem, const int threads = std::thread::hardware_concurrency())
+      : problem_(problem), threads_(std::max(1, threads)) {
+    for (int t = 0; t < threads_; t++) workers_.push_back(std::make_unique<Worker>());
+  }
+
+  /**
+   * @brief 从根节点开始搜索
+   *
+   * @param root 根节点
+   * @param initial 初始的最优解，例如0或INF，不优于它的节点都会被剪去
+   * @return Value 最优解的值，没有更优的解时为initial
+   */
+  Value solve(const Node& root, const Value initial) {
+    best_ = initial;
+    pending_ = 0;
+    for (auto& w : workers_) {
+      w->heap_.clear();
+      w->expanded_ = w->steals_ = 0;
+    }
+    push(*workers_[0], root);
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads_; t++) pool.emplace_back(&ParallelBranchAndBound::work, this, t);
+    work(0);
+    for (auto& th : pool) th.join();
+    return best_.load();
+  }
+
+  inline long long expanded() const {
+    long long res = 0;
+    for (const auto& w : workers_) res += w->expanded_;
+    return res;
+  }
+
+  inline long long steals() const {
+    long long res = 0;
+    for (const auto& w : workers_) res += w->steals_;
+    return res;
+  }
+};
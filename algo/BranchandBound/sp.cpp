@@ -2,63 +2,189 @@
  * @file sp.cpp
  * @author LyBin (lybin1336258176@outlook.com)
  * @brief 使用分支限界法求解单源最短路径问题
- * @version 1.0
- * @date 2024-11-23
- * 
+ *        图以CSR格式存储，见 graph/CSRGraph.hpp
+ *        节点按下界 cl_ + h(idx_) 出队（A*），h为到终点距离的可采纳下界：
+ *          h(v) = max(v到终点的最少边数 * 全图最小边权, v的最小出边权)，v为终点时为0，到不了终点时为INF
+ *        两者都满足 h(u) <= w(u,v) + h(v)，取最大值后仍然满足，因此每个顶点第一次以最优长度出队
+ *        剪枝：
+ *          限界：下界不小于当前最优解的节点不入队，出队节点的下界不小于最优解时整个队列都可以丢弃
+ *          支配：best_[v] 记录到达v的最短长度，不短于它的节点被支配，不入队；出队时已被支配的节点直接丢弃
+ *        运行结束后在标准错误输出扩展、限界剪枝与支配剪枝的节点数
+ *        sp [threads] < input    threads大于1时使用 ParallelBranchAndBound.hpp 多线程搜索，best_ 用原子变量更新
+ * @version 1.3
+ * @date 2026-10-17
+ *
  * @copyright Copyright (c) 2024
- * 
+ *
  */
-#include <bits/stdc++.h>
+#include "../../graph/CSRGraph.hpp"
+#include "ParallelBranchAndBound.hpp"
 
 constexpr int INF = 0x4fffffff;  // 无穷大
-constexpr int MaxN = 1e4;        // 最大允许的顶点数
-int G[MaxN][MaxN]{};             // 邻接矩阵存图
+CSRGraph G;                      // CSR存图
 int M, N;                        // 顶点数 边数
+std::vector<int> h;              // 各顶点到终点距离的下界
+std::vector<int> best;           // 到达各顶点的最短长度
+
+long long expanded;   // 扩展的节点数
+long long bounded;    // 因下界不小于最优解而剪去的节点数
+long long dominated;  // 被支配而剪去的节点数
 
 struct Node {
   int cl_{};   // 从源点到当前顶点的长度
   int idx_{};  // 当前顶点编号
-  bool operator>(const Node& x) const { return cl_ > x.cl_; }
+  int lb_{};   // 经过当前顶点的路径长度的下界 cl_ + h[idx_]
+  bool operator>(const Node& x) const { return lb_ > x.lb_; }
 };
 
 // 模拟最小堆
 std::priority_queue<Node, std::vector<Node>, std::greater<Node>> q{};
 
+/**
+ * @brief 计算下界h：在反向图上从终点BFS得到最少边数
+ */
+void bound() {
+  int minW = INF;
+  std::vector<int> minOut(M + 1, INF);
+  std::vector<std::vector<int>> radj(M + 1);  // 反向邻接表
+  for (int u = 1; u <= M; u++) {
+    for (const auto [v, w] : G.adj(u)) {
+      minW = std::min(minW, w);
+      minOut[u] = std::min(minOut[u], w);
+      radj[v].push_back(u);
+    }
+  }
+
+  std::vector<int> hops(M + 1, -1);
+  std::queue<int> bfs;
+  hops[M] = 0;
+  bfs.push(M);
+  while (!bfs.empty()) {
+    const int v = bfs.front();
+    bfs.pop();
+    for (const int u : radj[v]) {
+      if (hops[u] < 0) {
+        hops[u] = hops[v] + 1;
+        bfs.push(u);
+      }
+    }
+  }
+
+  h.assign(M + 1, INF);
+  h[M] = 0;
+  for (int v = 1; v < M; v++) {
+    if (hops[v] < 0) continue;
+    h[v] = std::max(static_cast<int>(std::min<long long>(1LL * hops[v] * minW, INF)), minOut[v]);
+  }
+}
+
 int solve() {
+  bound();
+  best.assign(M + 1, INF);
   int minPath{INF};
-  q.emplace(0, 1);      // 压入根节点
-  while (!q.empty()) {  // 广度优先搜索
+  if (h[1] == INF) return minPath;  // 起点到不了终点
+  best[1] = 0;
+  q.emplace(0, 1, h[1]);  // 压入根节点
+  while (!q.empty()) {  // 按下界从小到大搜索
     Node node = q.top();
     q.pop();
+    if (node.lb_ >= minPath) {  // 剩余节点的下界都不小于最优解
+      bounded += q.size() + 1;
+      break;
+    }
+    if (node.cl_ > best[node.idx_]) {  // 入队后出现了更短的到达方式
+      dominated++;
+      continue;
+    }
+    expanded++;
     if (node.idx_ == M) {  // 叶子节点
       minPath = std::min(minPath, node.cl_);
-    } else {  // 非叶子节点
-      for (int i = 1; i <= M; i++) {  // 遍历所有相邻顶点
-        int l = G[node.idx_][i];
-        if (l < INF && l + node.cl_ < minPath) {  // 剪枝
-          q.emplace(node.cl_ + l, i);
-        }
+      continue;
+    }
+    for (const auto [i, l] : G.adj(node.idx_)) {  // 遍历所有相邻顶点
+      const int cl = node.cl_ + l;
+      if (h[i] == INF || cl + h[i] >= minPath) {  // 限界剪枝
+        bounded++;
+      } else if (cl >= best[i]) {  // 支配剪枝
+        dominated++;
+      } else {
+        best[i] = cl;
+        q.emplace(cl, i, cl + h[i]);
       }
     }
   }
   return minPath;
 }
 
-int main() {
-  // 输入默认第一个顶点为起点，最后一个顶点为终点
-  std::cin >> M >> N;
-  for (int i = 0; i <= M; i++) {
-    for (int j = 0; j <= M; j++) {
-      G[i][j] = INF;
-    }
+// 多线程版本的问题描述，见 ParallelBranchAndBound.hpp
+struct ShortestPath {
+  using Node = ::Node;
+  using Value = int;
+  static constexpr bool kMaximize = false;
+
+  std::vector<std::atomic<int>> best_;  // 到达各顶点的最短长度
+  std::atomic<long long> bounded_{};
+  std::atomic<long long> dominated_{};
+  std::atomic<long long> stale_{};  // 出队时已被支配的节点数
+
+  ShortestPath() : best_(M + 1) {
+    for (auto& b : best_) b.store(INF, std::memory_order_relaxed);
+    best_[1].store(0, std::memory_order_relaxed);
   }
-  for (int i = 0; i < N; i++) {
-    int u, v, w;
-    std::cin >> u >> v >> w;
-    G[u][v] = w;
+
+  inline int bound(const Node& node) const { return node.lb_; }
+
+  inline bool leaf(const Node& node) const { return node.idx_ == M; }
+
+  inline int value(const Node& node) const { return node.cl_; }
+
+  template <typename Push>
+  void branch(const Node& node, const int minPath, Push&& push) {
+    if (node.cl_ > best_[node.idx_].load(std::memory_order_relaxed)) {  // 入队后出现了更短的到达方式
+      stale_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    long long bounded = 0, dominated = 0;
+    for (const auto [i, l] : G.adj(node.idx_)) {  // 遍历所有相邻顶点
+      const int cl = node.cl_ + l;
+      if (h[i] == INF || cl + h[i] >= minPath) {  // 限界剪枝
+        bounded++;
+        continue;
+      }
+      int cur = best_[i].load(std::memory_order_relaxed);
+      while (cl < cur && !best_[i].compare_exchange_weak(cur, cl, std::memory_order_relaxed)) {
+      }
+      if (cl >= cur) {  // 支配剪枝
+        dominated++;
+      } else {
+        push(Node{cl, i, cl + h[i]});
+      }
+    }
+    bounded_.fetch_add(bounded, std::memory_order_relaxed);
+    dominated_.fetch_add(dominated, std::memory_order_relaxed);
   }
+};
 
-  std::cout << solve() << '\n';
+int parallelSolve(int threads) {
+  bound();
+  if (h[1] == INF) return INF;  // 起点到不了终点
+  ShortestPath problem;
+  ParallelBranchAndBound<ShortestPath> engine(problem, threads);
+  const int minPath = engine.solve(Node{0, 1, h[1]}, INF);
+  expanded = engine.expanded() - problem.stale_;  // 引擎的扩展计数包含出队时被支配的节点
+  bounded = problem.bounded_;
+  dominated = problem.dominated_ + problem.stale_;
+  return minPath;
+}
+
+int main(int argc, char* argv[]) {
+  // 输入默认第一个顶点为起点，最后一个顶点为终点
+  std::cin >> M >> N;
+  G = CSRGraph::read(std::cin, M + 1, N);
+
+  const int threads = argc > 1 ? std::stoi(argv[1]) : 1;
+  std::cout << (threads > 1 ? parallelSolve(threads) : solve()) << '\n';
+  fprintf(stderr, "expanded %lld, bounded %lld, dominated %lld\n", expanded, bounded, dominated);
 
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,84 @@
+/**
+ * @file ConcurrentDisjointSet.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 无锁并查集的吞吐量测试，实现见 DisjointSet.hpp
+ *        输入 n m，生成m条随机边和m条幂律分布的边，分别用 1 ~ 2*核数 个线程并发调用 unite，
+ *        与互斥锁保护的 CompactDisjointSet 比较，并校验连通分量个数一致
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "DisjointSet.hpp"
+
+using Edges = std::vector<std::pair<uint32_t, uint32_t>>;
+
+/**
+ * @brief 把edges平均分给threads个线程，每个线程对自己那一段调用f
+ *
+ * @return double 耗时（毫秒）
+ */
+template <typename F>
+double run(const Edges& edges, const int threads, F f) {
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> pool;
+  const size_t chunk = (edges.size() + threads - 1) / threads;
+  for (int t = 0; t < threads; t++) {
+    pool.emplace_back([&, t]() {
+      const size_t lo = std::min(edges.size(), t * chunk);
+      const size_t hi = std::min(edges.size(), lo + chunk);
+      for (size_t i = lo; i < hi; i++) f(edges[i].first, edges[i].second);
+    });
+  }
+  for (auto& th : pool) th.join();
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench(const char* name, const uint32_t n, const Edges& edges) {
+  printf("%s: n=%u m=%zu\n", name, n, edges.size());
+  const int hw = std::max(1u, std::thread::hardware_concurrency());
+  for (int threads = 1; threads <= 2 * hw; threads <<= 1) {
+    CompactDisjointSet locked(n);
+    std::mutex mtx;
+    const double t1 = run(edges, threads, [&](uint32_t u, uint32_t v) {
+      std::lock_guard<std::mutex> lock(mtx);
+      locked.unite(u, v);
+    });
+
+    ConcurrentDisjointSet lockfree(n);
+    const double t2 = run(edges, threads, [&](uint32_t u, uint32_t v) { lockfree.unite(u, v); });
+
+    size_t c1{}, c2{};  // 连通分量个数
+    for (uint32_t i = 0; i < n; i++) {
+      c1 += locked.find(i) == static_cast<int>(i);
+      c2 += lockfree.find(i) == i;
+    }
+    printf("  threads=%-3d mutex %9.1f ms (%6.1f Medges/s)   lock-free %9.1f ms (%6.1f Medges/s)  "
+           "components=%zu%s\n",
+           threads, t1, edges.size() / t1 / 1e3, t2, edges.size() / t2 / 1e3, c2,
+           c1 == c2 ? "" : " MISMATCH");
+  }
+}
+
+int main() {
+  uint32_t n;
+  size_t m;
+  std::cin >> n >> m;
+
+  std::mt19937_64 gen(20241127);
+  Edges uniform(m), powerlaw(m);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  for (size_t i = 0; i < m; i++) {
+    uniform[i] = {static_cast<uint32_t>(gen() % n), static_cast<uint32_t>(gen() % n)};
+    // 端点编号取 n * u^3，小编号的顶点度数远大于大编号的顶点
+    const auto skew = [&]() { return static_cast<uint32_t>(n * std::pow(unit(gen), 3.0)) % n; };
+    powerlaw[i] = {skew(), skew()};
+  }
+
+  bench("uniform", n, uniform);
+  bench("power-law", n, powerlaw);
+
+  return 0;
+}
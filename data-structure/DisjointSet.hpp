@@ -0,0 +1,394 @@
+/**
+ * @file DisjointSet.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 并查集，支持查询、合并、删除、移动
+ *        DisjointSet：以副本作为根节点，每个元素16字节，递归路径压缩
+ *        CompactDisjointSet：父节点与集合大小打包在一个int32数组中，迭代式路径减半，每个元素4字节；
+ *                            删除、移动会追加新节点，节点数达到元素数的两倍时自动重建（compact），内存不超过约12字节/元素
+ *        ConcurrentDisjointSet：无锁并查集，CAS合并、无等待查询，可由多个线程同时调用
+ *        RollbackDisjointSet：可撤销并查集，按大小合并、不做路径压缩，可以回滚到任意快照
+ * @version 1.4
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <bits/stdc++.h>
+
+class DisjointSet {
+ private:
+  // pa_[i] 表示节点i的父节点
+  // size_[i] 表示节点i下的节点数量(包括自己)
+  std::vector<int> pa_, size_;
+
+ public:
+  DisjointSet() = default;
+  ~DisjointSet() = default;
+
+  /**
+   * @brief 构造并查集，size个元素，size个副本，以副本作为根节点
+   *        副本本身只起到标识不同集合的作用，前半段size_数组本身没有实际意义
+   * 
+   * @param size 元素个数
+   */
+  explicit DisjointSet(size_t size) : pa_(size * 2), size_(size * 2, 1) {
+    std::iota(pa_.begin(), pa_.begin() + size, size);
+    std::iota(pa_.begin() + size, pa_.end(), size);
+  }
+
+  /**
+   * @brief 查询元素x的根节点
+   * 
+   * @param x 
+   * @return int 
+   */
+  inline int find(size_t x) {
+    return pa_[x] == x ? x : pa_[x] = find(pa_[x]);  // 路径压缩：利用查询将节点直接连到根节点上，加快后续查询
+  }
+
+  /**
+   * @brief 合并两个元素所属集合
+   * 
+   * @param x 要合并的节点x
+   * @param y 要合并的节点y
+   */
+  inline void unite(size_t x, size_t y) {
+    x = find(x);
+    y = find(y);
+    if (x == y) return;
+    if (size_[x] < size_[y]) std::swap(x, y);  // 始终保证y是小集合，x是大集合
+    pa_[y] = x;
+    size_[x] += size_[y];
+  }
+
+  /**
+   * @brief 删除元素x（通过将x的根节点设置为自己）
+   * 
+   * @param x 
+   */
+  inline void erase(size_t x) {
+    pa_[x] = x;
+    --size_[x];
+  }
+
+  /**
+   * @brief 移动元素x到y所属集合
+   * 
+   * @param x 
+   * @param y 
+   */
+  inline void move(size_t x, size_t y) {
+    size_t px = find(x);
+    size_t py = find(y);
+    if (px == py) return;
+    pa_[x] = py;
+    --size_[px];
+    ++size_[py];
+  }
+};
+
+class CompactDisjointSet {
+ private:
+  // pa_[i] >= 0 表示节点i的父节点；pa_[i] < 0 表示节点i是根节点，-pa_[i] 为集合内的元素个数
+  std::vector<int32_t> pa_;
+  // node_[x] 表示元素x当前对应的节点，在第一次删除或移动之前为空，此时元素x就是节点x
+  // 删除或移动元素x时为其分配一个新节点，旧节点留在原集合中只起连接作用，不再计入集合大小
+  // 旧节点可能仍是其他节点的父节点，不能单独回收，只能由 compact 整体重建
+  std::vector<int32_t> node_;
+
+  inline int32_t node(const int x) const { return node_.empty() ? x : node_[x]; }
+
+  /**
+   * @brief 为元素x分配一个新的单元素节点
+   *
+   * @param x
+   * @return int32_t 新节点
+   */
+  inline int32_t detach(const int x) {
+    if (node_.empty()) {
+      node_.resize(size());
+      std::iota(node_.begin(), node_.end(), 0);
+    }
+    pa_.push_back(-1);
+    return node_[x] = static_cast<int32_t>(pa_.size()) - 1;
+  }
+
+  /**
+   * @brief 查询节点p的根节点（路径减半：每次把当前节点连到祖父节点上，并跳到祖父节点）
+   *
+   * @param p
+   * @return int32_t
+   */
+  inline int32_t root(int32_t p) {
+    while (pa_[p] >= 0) {
+      const int32_t q = pa_[p];
+      if (pa_[q] >= 0) pa_[p] = pa_[q];
+      p = pa_[p];
+    }
+    return p;
+  }
+
+ public:
+  CompactDisjointSet() = default;
+  ~CompactDisjointSet() = default;
+
+  /**
+   * @brief 构造并查集，size个元素，每个元素单独成为一个集合
+   *
+   * @param size 元素个数
+   */
+  explicit CompactDisjointSet(size_t size) : pa_(size, -1) {}
+
+  /**
+   * @brief 查询元素x的根节点
+   *
+   * @param x
+   * @return int
+   */
+  inline int find(const int x) { return root(node(x)); }
+
+  /**
+   * @brief 合并两个元素所属集合
+   *
+   * @param x 要合并的节点x
+   * @param y 要合并的节点y
+   */
+  inline void unite(const int x, const int y) {
+    int32_t rx = find(x);
+    int32_t ry = find(y);
+    if (rx == ry) return;
+    if (pa_[rx] > pa_[ry]) std::swap(rx, ry);  // 大小存为负数，始终保证rx是大集合
+    pa_[rx] += pa_[ry];
+    pa_[ry] = rx;
+  }
+
+  /**
+   * @brief 删除元素x（使x单独成为一个集合）
+   *
+   * @param x
+   */
+  inline void erase(const int x) {
+    if (pa_.size() >= 2 * size()) compact();
+    const int32_t rx = find(x);
+    if (pa_[rx] == -1) return;  // 集合中只有x
+    ++pa_[rx];
+    detach(x);
+  }
+
+  /**
+   * @brief 移动元素x到y所属集合
+   *
+   * @param x
+   * @param y
+   */
+  inline void move(const int x, const int y) {
+    if (pa_.size() >= 2 * size()) compact();
+    const int32_t rx = find(x);
+    const int32_t ry = find(y);
+    if (rx == ry) return;
+    if (pa_[rx] == -1) {  // 集合中只有x，直接把整个集合挂到y上
+      pa_[ry] += pa_[rx];
+      pa_[rx] = ry;
+      return;
+    }
+    ++pa_[rx];
+    const int32_t p = detach(x);
+    pa_[p] = ry;
+    --pa_[ry];
+  }
+
+  inline bool same(const int x, const int y) { return find(x) == find(y); }
+
+  /**
+   * @brief 元素x所在集合的元素个数
+   *
+   * @param x
+   * @return int
+   */
+  inline int count(const int x) { return -pa_[find(x)]; }
+
+  /**
+   * @brief 元素个数
+   *
+   * @return size_t
+   */
+  inline size_t size() const { return node_.empty() ? pa_.size() : node_.size(); }
+
+  /**
+   * @brief 丢弃删除、移动留下的旧节点，按当前的集合划分重建，之后元素x就是节点x，O(n α(n))
+   *        erase、move 在节点数达到元素数的两倍时自动调用，两次重建之间至少有n次删除或移动，均摊 O(α(n))
+   */
+  void compact() {
+    if (node_.empty()) return;
+    const size_t n = size();
+    std::vector<int32_t> rep(pa_.size(), -1);  // rep[旧根节点] = 新的根节点（该集合中编号最小的元素）
+    std::vector<int32_t> pa(n, -1);
+    for (size_t x = 0; x < n; x++) {
+      const int32_t r = find(static_cast<int>(x));
+      if (rep[r] < 0) {
+        rep[r] = static_cast<int32_t>(x);
+      } else {
+        pa[x] = rep[r];
+        --pa[rep[r]];
+      }
+    }
+    pa_.swap(pa);
+    std::vector<int32_t>().swap(node_);
+  }
+};
+
+class ConcurrentDisjointSet {
+ private:
+  // pa_[i] 表示节点i的父节点，pa_[i] == i 表示节点i是根节点
+  std::vector<std::atomic<uint32_t>> pa_;
+
+  /**
+   * @brief 节点的随机优先级，合并时优先级低的根挂到优先级高的根下，期望树高为 O(log n)
+   */
+  inline static uint64_t priority(const uint32_t x) {
+    uint64_t h = x * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 32;
+    return (h << 32) | x;  // 低32位放节点编号，保证优先级互不相同
+  }
+
+ public:
+  ConcurrentDisjointSet() = default;
+  ~ConcurrentDisjointSet() = default;
+
+  explicit ConcurrentDisjointSet(size_t size) : pa_(size) {
+    for (size_t i = 0; i < size; i++) {
+      pa_[i].store(static_cast<uint32_t>(i), std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief 查询元素x的根节点
+   *        路径减半用CAS完成，失败说明别的线程已经改过这个节点，直接跳过即可，不影响正确性
+   *
+   * @param x
+   * @return uint32_t
+   */
+  inline uint32_t find(uint32_t x) {
+    while (true) {
+      uint32_t p = pa_[x].load(std::memory_order_acquire);
+      if (p == x) return x;
+      const uint32_t gp = pa_[p].load(std::memory_order_acquire);
+      if (p != gp) {
+        pa_[x].compare_exchange_weak(p, gp, std::memory_order_release, std::memory_order_relaxed);
+      }
+      x = gp;
+    }
+  }
+
+  /**
+   * @brief 合并两个元素所属集合
+   *        只有当待挂的节点仍然是根节点时CAS才会成功，否则重新查找根节点后重试
+   *
+   * @param x
+   * @param y
+   * @return true 本次调用合并了两个不同的集合
+   * @return false 两个元素本来就在同一集合中
+   */
+  inline bool unite(uint32_t x, uint32_t y) {
+    while (true) {
+      x = find(x);
+      y = find(y);
+      if (x == y) return false;
+      if (priority(x) > priority(y)) std::swap(x, y);  // 始终把x挂到y下
+      uint32_t expected = x;
+      if (pa_[x].compare_exchange_strong(expected, y, std::memory_order_acq_rel)) return true;
+    }
+  }
+
+  /**
+   * @brief 判断两个元素是否在同一集合中（可线性化）
+   *        两个根不同且x仍然是根，说明在读到pa_[x]的时刻两者不在同一集合
+   *
+   * @param x
+   * @param y
+   * @return true
+   * @return false
+   */
+  inline bool same(uint32_t x, uint32_t y) {
+    while (true) {
+      x = find(x);
+      y = find(y);
+      if (x == y) return true;
+      if (pa_[x].load(std::memory_order_acquire) == x) return false;
+    }
+  }
+
+  inline size_t size() const { return pa_.size(); }
+};
+
+class RollbackDisjointSet {
+ private:
+  // pa_[i] 表示节点i的父节点，size_[i] 表示以i为根的集合大小
+  std::vector<int> pa_, size_;
+  // 每次成功的合并记录被挂上去的根节点，撤销时把它重新变回根节点
+  std::vector<int> history_;
+
+ public:
+  RollbackDisjointSet() = default;
+  ~RollbackDisjointSet() = default;
+
+  explicit RollbackDisjointSet(size_t size) : pa_(size), size_(size, 1) {
+    std::iota(pa_.begin(), pa_.end(), 0);
+  }
+
+  /**
+   * @brief 查询元素x的根节点，按大小合并保证树高为 O(log n)，因此不需要路径压缩
+   *
+   * @param x
+   * @return int
+   */
+  inline int find(int x) const {
+    while (pa_[x] != x) x = pa_[x];
+    return x;
+  }
+
+  /**
+   * @brief 合并两个元素所属集合
+   *
+   * @param x
+   * @param y
+   * @return true 合并了两个不同的集合
+   * @return false 两个元素本来就在同一集合中
+   */
+  inline bool unite(int x, int y) {
+    x = find(x);
+    y = find(y);
+    if (x == y) return false;
+    if (size_[x] < size_[y]) std::swap(x, y);
+    pa_[y] = x;
+    size_[x] += size_[y];
+    history_.push_back(y);
+    return true;
+  }
+
+  inline bool same(const int x, const int y) const { return find(x) == find(y); }
+
+  /**
+   * @brief 当前状态的快照，只是已执行的合并次数
+   *
+   * @return size_t
+   */
+  inline size_t snapshot() const { return history_.size(); }
+
+  /**
+   * @brief 撤销快照之后的所有合并
+   *
+   * @param snap 由 snapshot() 得到的快照
+   */
+  inline void rollback(const size_t snap) {
+    while (history_.size() > snap) {
+      const int y = history_.back();
+      history_.pop_back();
+      size_[pa_[y]] -= size_[y];
+      pa_[y] = y;
+    }
+  }
+};
@@ -0,0 +1,139 @@
+/**
+ * @file DynamicConnectivity.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 离线动态连通性：支持加边、删边、询问两点是否连通
+ *        每条边在时间轴上存活一段区间，把区间挂到时间轴线段树的 O(log T) 个节点上，
+ *        深度优先遍历线段树，进入节点时合并该节点上的边，离开时用可撤销并查集回滚，
+ *        到达叶子时回答该时刻的询问。每个操作均摊 O(log T log n)
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "DisjointSet.hpp"
+
+class OfflineDynamicConnectivity {
+ private:
+  struct Query {
+    int u_{}, v_{};
+  };
+
+  int n_{};
+  std::vector<Query> queries_;                             // 第t个操作若为询问，记录在queries_[t]中
+  std::vector<int> is_query_;                              // 第t个操作是否为询问
+  std::map<std::pair<int, int>, std::vector<int>> alive_;  // 尚未删除的边及其加入时刻（允许重边）
+  std::vector<std::tuple<int, int, int, int>> spans_;      // 边(u, v)在[l, r)时刻存在
+  std::vector<std::vector<std::pair<int, int>>> tree_;     // 时间轴线段树每个节点上的边
+
+  static std::pair<int, int> key(int u, int v) { return u < v ? std::pair{u, v} : std::pair{v, u}; }
+
+  /**
+   * @brief 把边挂到时间区间[ql, qr)完全覆盖的节点上
+   */
+  void insert(const int p, const int l, const int r, const int ql, const int qr,
+              const std::pair<int, int>& e) {
+    if (ql <= l && r <= qr) {
+      tree_[p].push_back(e);
+      return;
+    }
+    const int mid = (l + r) >> 1;
+    if (ql < mid) insert(p << 1, l, mid, ql, qr, e);
+    if (mid < qr) insert((p << 1) | 1, mid, r, ql, qr, e);
+  }
+
+  void dfs(const int p, const int l, const int r, RollbackDisjointSet& dsu,
+           std::vector<bool>& res) const {
+    const size_t snap = dsu.snapshot();
+    for (const auto& [u, v] : tree_[p]) dsu.unite(u, v);
+    if (r - l == 1) {
+      if (is_query_[l]) res.push_back(dsu.same(queries_[l].u_, queries_[l].v_));
+    } else {
+      const int mid = (l + r) >> 1;
+      dfs(p << 1, l, mid, dsu, res);
+      dfs((p << 1) | 1, mid, r, dsu, res);
+    }
+    dsu.rollback(snap);
+  }
+
+  inline int now() const { return static_cast<int>(is_query_.size()); }
+
+ public:
+  explicit OfflineDynamicConnectivity(const int n) : n_(n) {}
+
+  /**
+   * @brief 加入边(u, v)
+   */
+  void addEdge(const int u, const int v) {
+    alive_[key(u, v)].push_back(now());
+    queries_.emplace_back();
+    is_query_.push_back(0);
+  }
+
+  /**
+   * @brief 删除一条已存在的边(u, v)，边不存在时忽略
+   */
+  void removeEdge(const int u, const int v) {
+    auto it = alive_.find(key(u, v));
+    if (it != alive_.end()) {
+      spans_.emplace_back(u, v, it->second.back(), now());
+      it->second.pop_back();
+      if (it->second.empty()) alive_.erase(it);
+    }
+    queries_.emplace_back();
+    is_query_.push_back(0);
+  }
+
+  /**
+   * @brief 询问此刻u和v是否连通
+   */
+  void connected(const int u, const int v) {
+    queries_.push_back({u, v});
+    is_query_.push_back(1);
+  }
+
+  /**
+   * @brief 回答所有询问
+   *
+   * @return std::vector<bool> 按询问出现的顺序排列的答案
+   */
+  std::vector<bool> solve() {
+    const int T = std::max(1, now());
+    for (const auto& [e, starts] : alive_) {  // 直到最后都没有删除的边
+      for (const int l : starts) spans_.emplace_back(e.first, e.second, l, T);
+    }
+    alive_.clear();
+    tree_.assign(4 * T, {});
+    for (const auto& [u, v, l, r] : spans_) {
+      if (l < r) insert(1, 0, T, l, r, {u, v});
+    }
+    std::vector<bool> res;
+    RollbackDisjointSet dsu(n_ + 1);
+    if (now() > 0) dfs(1, 0, T, dsu, res);
+    return res;
+  }
+};
+
+int main() {
+  // 操作1 u v：加边；操作2 u v：删边；操作3 u v：询问u和v是否连通
+  int n, q;
+  std::cin >> n >> q;
+  OfflineDynamicConnectivity dc(n);
+  for (int i = 0; i < q; i++) {
+    int op, u, v;
+    std::cin >> op >> u >> v;
+    if (op == 1) {
+      dc.addEdge(u, v);
+    } else if (op == 2) {
+      dc.removeEdge(u, v);
+    } else {
+      dc.connected(u, v);
+    }
+  }
+  for (const bool ok : dc.solve()) {
+    std::cout << (ok ? "Yes" : "No") << '\n';
+  }
+
+  return 0;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file FenwickTree.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 树状数组实现区间加、区间求和，实现见 FenwickTree.hpp
+ *        RangeTree 根据所需的操作自动选择树状数组或懒标记线段树
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "FenwickTree.hpp"
+
+int main() {
+  int n{};
+  std::cin >> n;
+  std::vector<long long> num(n);
+  for (int i = 0; i < n; i++) {
+    std::cin >> num[i];
+  }
+
+  RangeTree<> sum_tree(num);                                          // FenwickTree<long long>
+  RangeTree<MinMonoid<long long>, AddLazy<long long>> min_tree(num);  // SegmentTree
+  static_assert(std::is_same_v<decltype(sum_tree), FenwickTree<long long>>);
+
+  std::cout << sum_tree.query(1, 3) << ' ' << min_tree.query(1, 3) << '\n';
+  sum_tree.update(1, 4, 2);
+  min_tree.update(1, 4, 2);
+  std::cout << sum_tree.query(0, 3) << ' ' << min_tree.query(0, 3) << '\n';
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file FenwickTree.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 树状数组（区间加、区间求和），与 SegmentTree 提供相同的 build/update/query 接口
+ *        维护差分数组 b 的两个树状数组 sum(b[i]) 与 sum(b[i]*(i-1))，前缀和 = x*sum(b[i]) - sum(b[i]*(i-1))
+ *        只需要 2(n+1) 个元素，所有操作都是非递归的短循环
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include "SegmentTree.hpp"
+
+template <typename T = long long>
+class FenwickTree {
+ public:
+  using value_type = T;
+  using tag_type = T;
+
+ private:
+  int n_{};
+  // 下标从1开始，d1_维护差分b[i]，d2_维护b[i]*(i-1)
+  std::vector<T> d1_, d2_;
+
+  inline static int lowbit(const int x) { return x & -x; }
+
+  inline void add(int x, const T& k) {
+    const T ki = k * (x - 1);
+    for (; x <= n_; x += lowbit(x)) {
+      d1_[x] += k;
+      d2_[x] += ki;
+    }
+  }
+
+  /**
+   * @brief 前缀和 a[0] + ... + a[x-1]
+   *
+   * @param x 前缀长度
+   * @return T
+   */
+  inline T prefix(const int x) const {
+    T s1{}, s2{};
+    for (int i = x; i > 0; i -= lowbit(i)) {
+      s1 += d1_[i];
+      s2 += d2_[i];
+    }
+    return s1 * x - s2;
+  }
+
+ public:
+  FenwickTree() = default;
+  ~FenwickTree() = default;
+
+  explicit FenwickTree(const int n) : n_(n), d1_(n + 1), d2_(n + 1) {}
+
+  explicit FenwickTree(const std::vector<T>& v) { build(v); }
+
+  /**
+   * @brief 建树，O(n)：先写入差分，再把每个节点一次性加到它的父节点上
+   *
+   * @param v 目标数组
+   */
+  void build(const std::vector<T>& v) {
+    n_ = static_cast<int>(v.size());
+    d1_.assign(n_ + 1, T{});
+    d2_.assign(n_ + 1, T{});
+    for (int i = 1; i <= n_; i++) {
+      const T b = v[i - 1] - (i > 1 ? v[i - 2] : T{});
+      d1_[i] += b;
+      d2_[i] += b * (i - 1);
+      const int j = i + lowbit(i);
+      if (j <= n_) {
+        d1_[j] += d1_[i];
+        d2_[j] += d2_[i];
+      }
+    }
+  }
+
+  /**
+   * @brief 区间修改（区间[ql, qr]内每个值加上k）
+   *
+   * @param ql 修改区间起始点
+   * @param qr 修改区间结束点
+   * @param k 变化量
+   */
+  inline void update(const int ql, const int qr, const T& k) {
+    if (ql > qr) return;
+    add(ql + 1, k);
+    add(qr + 2, -k);
+  }
+
+  /**
+   * @brief 区间求和
+   *
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @return T
+   */
+  inline T query(const int ql, const int qr) const {
+    if (ql > qr) return T{};
+    return prefix(qr + 1) - prefix(ql);
+  }
+
+  inline T get(const int x) const { return query(x, x); }
+
+  inline void set(const int x, const T& val) { update(x, x, val - get(x)); }
+
+  inline T all() const { return prefix(n_); }
+
+  inline int size() const { return n_; }
+};
+
+/* -------------------------------------------- 门面 -------------------------------------------- */
+// RangeTree<Monoid, Lazy> 在编译期选择后端：
+// 只需要区间加、区间求和时使用树状数组，求最小值/最大值时退回到懒标记线段树
+
+template <typename Monoid, typename Lazy>
+struct RangeTreeSelector {
+  using type = SegmentTree<Monoid, Lazy>;
+};
+
+template <typename T>
+struct RangeTreeSelector<SumMonoid<T>, AddLazy<T>> {
+  using type = FenwickTree<T>;
+};
+
+template <typename Monoid = SumMonoid<long long>, typename Lazy = AddLazy<long long>>
+using RangeTree = typename RangeTreeSelector<Monoid, Lazy>::type;
@@ -0,0 +1,217 @@
+/**
+ * @file PersistentSegmentTree.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 可持久化线段树（区间加、区间求和），可以在 O(log N) 的时间复杂度内查询任意历史版本
+ *        每次修改只复制根到被修改节点路径上的 O(log N) 个节点（路径复制），其余节点与旧版本共享
+ *        懒标记永久化：标记留在节点上不下传，查询时沿路径累加，因此旧版本的节点永远不会被改写
+ *        所有节点分配在同一块连续内存池中，用下标代替指针，所有版本可一次性释放
+ * @version 1.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <bits/stdc++.h>
+
+class PersistentSegmentTree {
+ private:
+  struct Node {
+    long long sum_{};  // 该节点管辖区间的和（包含本节点及子树上的所有标记）
+    long long tag_{};  // 永久化的懒标记，对整个管辖区间生效
+    int ls_{};         // 左子节点在内存池中的下标
+    int rs_{};         // 右子节点在内存池中的下标
+  };
+
+  int n_{};                  // 元素个数
+  std::vector<Node> pool_;   // 节点内存池，只追加不释放
+  std::vector<int> roots_;   // roots_[v] 表示第v个版本的根节点，版本0为初始数组
+
+  /**
+   * @brief 从内存池中分配一个节点
+   *
+   * @param node 新节点的初值
+   * @return int 新节点下标
+   */
+  inline int alloc(const Node& node) {
+    pool_.push_back(node);
+    return static_cast<int>(pool_.size()) - 1;
+  }
+
+  int build(const std::vector<long long>& num, const int l, const int r) {
+    const int p = alloc({});
+    if (l == r) {
+      pool_[p].sum_ = num[l];
+      return p;
+    }
+    const int mid = (l + r) >> 1;
+    const int ls = build(num, l, mid);  // 先递归再赋值，防止内存池扩容使引用失效
+    const int rs = build(num, mid + 1, r);
+    pool_[p].ls_ = ls;
+    pool_[p].rs_ = rs;
+    pool_[p].sum_ = pool_[ls].sum_ + pool_[rs].sum_;
+    return p;
+  }
+
+  /**
+   * @brief 区间修改：复制路径上的节点，返回新节点
+   *
+   * @param pre 旧版本中对应的节点
+   * @param l 节点管辖的区间起始点
+   * @param r 节点管辖的区间结束点
+   * @param ql 修改区间起始点
+   * @param qr 修改区间结束点
+   * @param k 变化量
+   * @return int 新版本中的节点
+   */
+  int update(const int pre, const int l, const int r, const int ql, const int qr,
+             const long long k) {
+    const int p = alloc(pool_[pre]);
+    pool_[p].sum_ += k * (std::min(r, qr) - std::max(l, ql) + 1);
+    if (ql <= l && r <= qr) {
+      pool_[p].tag_ += k;
+      return p;
+    }
+    const int mid = (l + r) >> 1;
+    if (ql <= mid) {
+      const int ls = update(pool_[pre].ls_, l, mid, ql, qr, k);
+      pool_[p].ls_ = ls;
+    }
+    if (mid + 1 <= qr) {
+      const int rs = update(pool_[pre].rs_, mid + 1, r, ql, qr, k);
+      pool_[p].rs_ = rs;
+    }
+    return p;
+  }
+
+  /**
+   * @brief 区间查询
+   *
+   * @param p 当前节点
+   * @param l 节点管辖的区间起始点
+   * @param r 节点管辖的区间结束点
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @param acc 祖先节点上累积的标记
+   * @return long long
+   */
+  long long query(const int p, const int l, const int r, const int ql, const int qr,
+                  const long long acc) const {
+    if (ql <= l && r <= qr) return pool_[p].sum_ + acc * (r - l + 1);
+    const long long tag = acc + pool_[p].tag_;
+    const int mid = (l + r) >> 1;
+    long long sum{};
+    if (ql <= mid) sum += query(pool_[p].ls_, l, mid, ql, qr, tag);
+    if (mid + 1 <= qr) sum += query(pool_[p].rs_, mid + 1, r, ql, qr, tag);
+    return sum;
+  }
+
+ public:
+  PersistentSegmentTree() = default;
+  ~PersistentSegmentTree() = default;
+
+  /**
+   * @brief 以数组num构造版本0
+   *
+   * @param num 目标数组
+   * @param updates 预计的修改次数，用于预先分配内存池；不知道时传0，内存池按倍增扩容
+   */
+  explicit PersistentSegmentTree(const std::vector<long long>& num, const int updates = 0) {
+    build(num, updates);
+  }
+
+  /**
+   * @brief 建树，丢弃之前的所有版本
+   *
+   * @param num 目标数组
+   * @param updates 预计的修改次数，用于预先分配内存池
+   */
+  void build(const std::vector<long long>& num, const int updates = 0) {
+    clear();
+    n_ = static_cast<int>(num.size());
+    if (n_ == 0) return;
+    const int height = std::__lg(n_) + 2;
+    // 建树需要2n-1个节点，每次区间修改最多复制约4*height个节点
+    pool_.reserve(2 * static_cast<size_t>(n_) + static_cast<size_t>(updates) * 4 * height);
+    roots_.push_back(build(num, 0, n_ - 1));
+  }
+
+  /**
+   * @brief 在版本ver的基础上对区间[ql, qr]加上k，生成一个新版本
+   *
+   * @param ver 基础版本
+   * @param ql 修改区间起始点
+   * @param qr 修改区间结束点
+   * @param k 变化量
+   * @return int 新版本号
+   */
+  int update(const int ver, const int ql, const int qr, const long long k) {
+    if (roots_.empty()) throw std::logic_error("PersistentSegmentTree::update on an empty tree");
+    roots_.push_back(update(roots_[ver], 0, n_ - 1, ql, qr, k));
+    return static_cast<int>(roots_.size()) - 1;
+  }
+
+  /**
+   * @brief 在最新版本的基础上修改，第i次修改后得到版本i
+   */
+  inline int update(const int ql, const int qr, const long long k) {
+    return update(latest(), ql, qr, k);
+  }
+
+  /**
+   * @brief 查询版本ver中区间[ql, qr]的和
+   *
+   * @param ver 版本号
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @return long long
+   */
+  inline long long query(const int ver, const int ql, const int qr) const {
+    return query(roots_[ver], 0, n_ - 1, ql, qr, 0);
+  }
+
+  /**
+   * @brief 释放所有版本
+   */
+  void clear() {
+    n_ = 0;
+    std::vector<Node>().swap(pool_);
+    roots_.clear();
+  }
+
+  inline int latest() const { return static_cast<int>(roots_.size()) - 1; }
+
+  inline size_t nodes() const { return pool_.size(); }
+};
+
+int main() {
+  // 操作1 x y k：区间[x, y]加k，生成新版本
+  // 操作2 x y：查询最新版本中区间[x, y]的和
+  // 操作3 v x y：查询第v次修改后区间[x, y]的和（v = 0 表示初始数组）
+  int n, m;
+  std::cin >> n >> m;
+  std::vector<long long> num(n);
+  for (int i = 0; i < n; i++) {
+    std::cin >> num[i];
+  }
+  PersistentSegmentTree tree(num);  // m包含查询，修改次数事先未知，内存池按需扩容
+  for (int i = 0; i < m; i++) {
+    int op{};
+    std::cin >> op;
+    if (op == 1) {
+      int x, y, k;
+      std::cin >> x >> y >> k;
+      tree.update(x - 1, y - 1, k);
+    } else if (op == 2) {
+      int x, y;
+      std::cin >> x >> y;
+      std::cout << tree.query(tree.latest(), x - 1, y - 1) << '\n';
+    } else {
+      int v, x, y;
+      std::cin >> v >> x >> y;
+      std::cout << tree.query(v, x - 1, y - 1) << '\n';
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,307 @@
+/**
+ * @file SegmentTree.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 非递归（自底向上）懒标记线段树模板
+ *        以幺半群(Monoid)描述区间信息的合并方式（求和、最小值、最大值），以懒标记(Lazy)描述区间修改（区间加）
+ *        节点按堆式编号存放在一个数组中，叶子数向上补齐为2的幂，共2*size个节点，不再需要全局数组
+ * @version 2.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <bits/stdc++.h>
+
+/* ------------------------------------------- 幺半群 ------------------------------------------- */
+// 每个幺半群需提供：
+//   value_type             区间信息的类型
+//   id()                   单位元（空区间的值）
+//   op(a, b)               合并左右两段区间的信息
+//   repeat(x, len)         将同一个值x合并len次的结果，供区间加时计算整段的变化量
+
+template <typename T>
+struct SumMonoid {
+  using value_type = T;
+  static T id() { return T{}; }
+  static T op(const T& a, const T& b) { return a + b; }
+  static T repeat(const T& x, const int len) { return x * len; }
+};
+
+template <typename T>
+struct MinMonoid {
+  using value_type = T;
+  static T id() { return std::numeric_limits<T>::max(); }
+  static T op(const T& a, const T& b) { return std::min(a, b); }
+  static T repeat(const T& x, const int) { return x; }
+};
+
+template <typename T>
+struct MaxMonoid {
+  using value_type = T;
+  static T id() { return std::numeric_limits<T>::lowest(); }
+  static T op(const T& a, const T& b) { return std::max(a, b); }
+  static T repeat(const T& x, const int) { return x; }
+};
+
+/* ------------------------------------------- 懒标记 ------------------------------------------- */
+// 每个懒标记需提供：
+//   tag_type               标记的类型
+//   id()                   空标记
+//   apply<Monoid>(x, f, len)  将标记f作用到长度为len的区间信息x上
+//   compose(f, g)          先作用g再作用f，合并为一个标记
+
+template <typename T>
+struct AddLazy {
+  using tag_type = T;
+  static T id() { return T{}; }
+  template <typename Monoid>
+  static typename Monoid::value_type apply(const typename Monoid::value_type& x, const T& f,
+                                           const int len) {
+    return x + Monoid::repeat(f, len);
+  }
+  static T compose(const T& f, const T& g) { return f + g; }
+};
+
+/* ------------------------------------------- 线段树 ------------------------------------------- */
+template <typename Monoid = SumMonoid<long long>, typename Lazy = AddLazy<long long>>
+class SegmentTree {
+ public:
+  using value_type = typename Monoid::value_type;
+  using tag_type = typename Lazy::tag_type;
+
+ private:
+  int n_{};     // 元素个数
+  int log_{};   // 树高
+  int size_{};  // 叶子数，n_向上补齐到2的幂
+  // tree_[p] 为节点p管辖区间的信息，根为1，叶子位于[size_, 2*size_)
+  // lazytag_[p] 为内部节点p尚未下传的标记，叶子不需要标记
+  std::vector<value_type> tree_;
+  std::vector<tag_type> lazytag_;
+
+  inline void pushup(const int p) { tree_[p] = Monoid::op(tree_[p << 1], tree_[(p << 1) | 1]); }
+
+  /**
+   * @brief 为节点p添加懒惰标记
+   *        区间长度只统计真实元素，完全落在补齐部分的节点保持单位元不变
+   *
+   * @param p 第p个节点
+   * @param f 标记
+   */
+  inline void addTag(const int p, const tag_type& f) {
+    const int h = std::__lg(p);
+    const int w = size_ >> h;            // 节点p名义上管辖的叶子数
+    const int l = (p ^ (1 << h)) * w;    // 节点p管辖区间的起始点
+    const int len = std::min(w, n_ - l);
+    if (len <= 0) return;
+    tree_[p] = Lazy::template apply<Monoid>(tree_[p], f, len);
+    if (p < size_) lazytag_[p] = Lazy::compose(f, lazytag_[p]);
+  }
+
+  /**
+   * @brief 下传节点p的懒惰标记
+   *
+   * @param p 第p个节点
+   */
+  inline void pushdown(const int p) {
+    if (lazytag_[p] == Lazy::id()) return;
+    addTag(p << 1, lazytag_[p]);
+    addTag((p << 1) | 1, lazytag_[p]);
+    lazytag_[p] = Lazy::id();
+  }
+
+  // 只读查询的递归部分，acc为祖先节点上尚未下传的标记的合成
+  value_type peek(const int p, const int l, const int r, const int ql, const int qr,
+                  const tag_type& acc) const {
+    if (ql <= l && r <= qr) {
+      const int len = std::min(r, n_ - 1) - l + 1;
+      return len > 0 ? Lazy::template apply<Monoid>(tree_[p], acc, len) : tree_[p];
+    }
+    const tag_type tag = Lazy::compose(acc, lazytag_[p]);
+    const int mid = (l + r) >> 1;
+    value_type res = Monoid::id();
+    if (ql <= mid) res = Monoid::op(res, peek(p << 1, l, mid, ql, qr, tag));
+    if (mid + 1 <= qr) res = Monoid::op(res, peek((p << 1) | 1, mid + 1, r, ql, qr, tag));
+    return res;
+  }
+
+ public:
+  SegmentTree() = default;
+  ~SegmentTree() = default;
+
+  /**
+   * @brief 构造n个元素均为单位元的线段树
+   *
+   * @param n 元素个数
+   */
+  explicit SegmentTree(const int n) { build(std::vector<value_type>(n, Monoid::id())); }
+
+  /**
+   * @brief 以数组v构造线段树
+   *
+   * @param v 目标数组
+   */
+  explicit SegmentTree(const std::vector<value_type>& v) { build(v); }
+
+  /**
+   * @brief 建树，O(n)
+   *        threads > 1 时把树按第d层切成 2^d 棵子树（2^d >= threads），每棵子树由一个线程自底向上建立，
+   *        最后串行合并顶部的d层
+   *
+   * @param v 目标数组
+   * @param threads 线程数
+   */
+  void build(const std::vector<value_type>& v, const int threads = 1) {
+    n_ = static_cast<int>(v.size());
+    log_ = 0;
+    while ((1 << log_) < n_) log_++;
+    size_ = 1 << log_;
+    tree_.assign(size_ << 1, Monoid::id());
+    lazytag_.assign(size_, Lazy::id());
+
+    int d = 0;
+    while ((1 << d) < threads && d < log_) d++;
+    const int w = size_ >> d;  // 每棵子树的叶子数
+    auto work = [&](const int i) {
+      const int lo = std::min(i * w, n_);
+      const int hi = std::min(lo + w, n_);
+      std::copy(v.begin() + lo, v.begin() + hi, tree_.begin() + size_ + lo);
+      for (int depth = log_ - 1; depth >= d; depth--) {
+        const int first = ((1 << d) + i) << (depth - d);  // 子树在该层最左侧的节点
+        for (int p = first; p < first + (1 << (depth - d)); p++) pushup(p);
+      }
+    };
+    if (d == 0) {
+      work(0);
+    } else {
+      std::vector<std::thread> pool;
+      for (int i = 0; i < (1 << d); i++) pool.emplace_back(work, i);
+      for (auto& t : pool) t.join();
+    }
+    for (int p = (1 << d) - 1; p >= 1; p--) pushup(p);
+  }
+
+  /**
+   * @brief 单点修改，将第x个元素设为val
+   *
+   * @param x 元素下标(从0开始)
+   * @param val 新值
+   */
+  void set(int x, const value_type& val) {
+    x += size_;
+    for (int i = log_; i >= 1; i--) pushdown(x >> i);
+    tree_[x] = val;
+    for (int i = 1; i <= log_; i++) pushup(x >> i);
+  }
+
+  /**
+   * @brief 单点查询
+   *
+   * @param x 元素下标(从0开始)
+   * @return value_type
+   */
+  value_type get(int x) {
+    x += size_;
+    for (int i = log_; i >= 1; i--) pushdown(x >> i);
+    return tree_[x];
+  }
+
+  /**
+   * @brief 区间修改（区间[ql, qr]内每个值都作用标记k，对区间加即加上k）
+   *        先自顶向下下传两端路径上的标记，再自底向上打标记，最后重新合并两端路径
+   *
+   * @param ql 修改区间起始点
+   * @param qr 修改区间结束点
+   * @param k 变化量
+   */
+  void update(int ql, int qr, const tag_type& k) {
+    if (ql > qr) return;
+    int l = ql + size_;
+    int r = qr + 1 + size_;
+    for (int i = log_; i >= 1; i--) {
+      if (((l >> i) << i) != l) pushdown(l >> i);
+      if (((r >> i) << i) != r) pushdown((r - 1) >> i);
+    }
+    for (int a = l, b = r; a < b; a >>= 1, b >>= 1) {
+      if (a & 1) addTag(a++, k);
+      if (b & 1) addTag(--b, k);
+    }
+    for (int i = 1; i <= log_; i++) {
+      if (((l >> i) << i) != l) pushup(l >> i);
+      if (((r >> i) << i) != r) pushup((r - 1) >> i);
+    }
+  }
+
+  /**
+   * @brief 区间查询
+   *
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @return value_type
+   */
+  value_type query(int ql, int qr) {
+    if (ql > qr) return Monoid::id();
+    int l = ql + size_;
+    int r = qr + 1 + size_;
+    for (int i = log_; i >= 1; i--) {
+      if (((l >> i) << i) != l) pushdown(l >> i);
+      if (((r >> i) << i) != r) pushdown((r - 1) >> i);
+    }
+    value_type sml = Monoid::id(), smr = Monoid::id();  // 分别从左右两端向中间合并，保证合并顺序
+    for (; l < r; l >>= 1, r >>= 1) {
+      if (l & 1) sml = Monoid::op(sml, tree_[l++]);
+      if (r & 1) smr = Monoid::op(tree_[--r], smr);
+    }
+    return Monoid::op(sml, smr);
+  }
+
+  /**
+   * @brief 只读的区间查询，不下传标记，可以被多个线程同时调用
+   *        自顶向下把祖先上尚未下传的标记合并后作用到完整覆盖的节点上
+   *
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @return value_type
+   */
+  value_type peek(const int ql, const int qr) const {
+    if (ql > qr) return Monoid::id();
+    return peek(1, 0, size_ - 1, ql, qr, Lazy::id());
+  }
+
+  /**
+   * @brief 批量只读查询，查询之间没有修改，由threads个线程按块领取并行回答
+   *
+   * @param qs 查询区间[ql, qr]
+   * @param threads 线程数
+   * @return std::vector<value_type> 按输入顺序排列的答案
+   */
+  std::vector<value_type> queryBatch(const std::vector<std::pair<int, int>>& qs,
+                                     int threads = std::thread::hardware_concurrency()) const {
+    std::vector<value_type> res(qs.size());
+    constexpr size_t kChunk = 1024;
+    std::atomic<size_t> next{0};
+    auto work = [&]() {
+      for (size_t lo; (lo = next.fetch_add(kChunk)) < qs.size();) {
+        const size_t hi = std::min(lo + kChunk, qs.size());
+        for (size_t i = lo; i < hi; i++) res[i] = peek(qs[i].first, qs[i].second);
+      }
+    };
+    threads = std::max(1, std::min<int>(threads, (qs.size() + kChunk - 1) / kChunk));
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++) pool.emplace_back(work);
+    work();
+    for (auto& t : pool) t.join();
+    return res;
+  }
+
+  /**
+   * @brief 整个数组的信息
+   *
+   * @return value_type
+   */
+  inline value_type all() const { return tree_[1]; }
+
+  inline int size() const { return n_; }
+};
@@ -0,0 +1,31 @@
+/**
+ * @file SparseTable.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 静态数组的区间最值查询，实现见 SparseTable.hpp
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "SparseTable.hpp"
+
+int main() {
+  int n, m;
+  std::cin >> n >> m;
+  std::vector<int> num(n);
+  for (int i = 0; i < n; i++) {
+    std::cin >> num[i];
+  }
+
+  SparseTable<MaxMonoid<int>> st_max(num);      // O(n log n) 空间
+  BlockSparseTable<MinMonoid<int>> st_min(num);  // O(n) 空间
+  for (int i = 0; i < m; i++) {
+    int x, y;
+    std::cin >> x >> y;
+    std::cout << st_min.query(x - 1, y - 1) << ' ' << st_max.query(x - 1, y - 1) << '\n';
+  }
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file SparseTable.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 静态数组的区间最值查询(RMQ)
+ *        SparseTable：ST表，O(n log n) 预处理，O(1) 查询
+ *        BlockSparseTable：按64个元素分块，ST表只建在块的最值上，块内用单调栈位掩码查询，O(n) 预处理，O(1) 查询
+ *        与 SegmentTree 使用相同的幺半群（只能是 MinMonoid/MaxMonoid 这类幂等运算）和相同的 build/query 接口，
+ *        静态数组上可以把 SegmentTree<MinMonoid<T>> 直接换成 SparseTable<MinMonoid<T>>
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include "SegmentTree.hpp"
+
+template <typename Monoid>
+class SparseTable {
+ public:
+  using value_type = typename Monoid::value_type;
+
+ private:
+  int n_{};
+  // st_[k * n_ + i] 表示区间[i, i + 2^k - 1]的最值
+  std::vector<value_type> st_;
+
+ public:
+  SparseTable() = default;
+  ~SparseTable() = default;
+
+  explicit SparseTable(const std::vector<value_type>& v) { build(v); }
+
+  /**
+   * @brief 预处理，st[k][i] = op(st[k-1][i], st[k-1][i + 2^(k-1)])
+   *
+   * @param v 目标数组
+   */
+  void build(const std::vector<value_type>& v) {
+    n_ = static_cast<int>(v.size());
+    const int levels = n_ ? std::__lg(n_) + 1 : 0;
+    st_.resize(static_cast<size_t>(levels) * n_);
+    std::copy(v.begin(), v.end(), st_.begin());
+    for (int k = 1; k < levels; k++) {
+      const value_type* pre = st_.data() + static_cast<size_t>(k - 1) * n_;
+      value_type* cur = st_.data() + static_cast<size_t>(k) * n_;
+      for (int i = 0; i + (1 << k) <= n_; i++) cur[i] = Monoid::op(pre[i], pre[i + (1 << (k - 1))]);
+    }
+  }
+
+  /**
+   * @brief 区间查询，两个长度为2^k的区间覆盖[ql, qr]，重叠部分不影响最值
+   *
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @return value_type
+   */
+  inline value_type query(const int ql, const int qr) const {
+    if (ql > qr) return Monoid::id();
+    const int k = std::__lg(qr - ql + 1);
+    const value_type* row = st_.data() + static_cast<size_t>(k) * n_;
+    return Monoid::op(row[ql], row[qr - (1 << k) + 1]);
+  }
+
+  inline int size() const { return n_; }
+};
+
+template <typename Monoid>
+class BlockSparseTable {
+ public:
+  using value_type = typename Monoid::value_type;
+
+ private:
+  static constexpr int kBlock = 64;  // 块长等于位掩码的位数
+
+  int n_{};
+  std::vector<value_type> num_;
+  // mask_[i] 的第j位(j <= i % 64)为1，表示块内第j个元素是块内区间[j, i % 64]的最值，
+  // 即处理到第i个元素时单调栈中的元素
+  std::vector<uint64_t> mask_;
+  SparseTable<Monoid> block_;  // 每个块的最值组成的ST表
+
+  /**
+   * @brief 块内查询，[ql, qr]必须位于同一个块中
+   *        mask_[qr]中不小于ql的最低位即为区间最值所在位置
+   */
+  inline value_type inBlock(const int ql, const int qr) const {
+    const uint64_t m = mask_[qr] >> (ql % kBlock);
+    return num_[ql + __builtin_ctzll(m)];
+  }
+
+ public:
+  BlockSparseTable() = default;
+  ~BlockSparseTable() = default;
+
+  explicit BlockSparseTable(const std::vector<value_type>& v) { build(v); }
+
+  /**
+   * @brief 预处理，O(n)
+   *
+   * @param v 目标数组
+   */
+  void build(const std::vector<value_type>& v) {
+    n_ = static_cast<int>(v.size());
+    num_ = v;
+    mask_.assign(n_, 0);
+    std::vector<value_type> blocks((n_ + kBlock - 1) / kBlock, Monoid::id());
+    uint64_t cur = 0;
+    for (int i = 0; i < n_; i++) {
+      const int j = i % kBlock;
+      const int base = i - j;
+      if (j == 0) cur = 0;
+      // 栈顶元素不优于num_[i]时出栈
+      while (cur) {
+        const int top = 63 - __builtin_clzll(cur);
+        if (Monoid::op(num_[i], num_[base + top]) != num_[i]) break;
+        cur ^= 1ULL << top;
+      }
+      cur |= 1ULL << j;
+      mask_[i] = cur;
+      blocks[i / kBlock] = Monoid::op(blocks[i / kBlock], num_[i]);
+    }
+    block_.build(blocks);
+  }
+
+  /**
+   * @brief 区间查询：左右两个不完整的块在块内查询，中间的完整块查ST表
+   *
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @return value_type
+   */
+  inline value_type query(const int ql, const int qr) const {
+    if (ql > qr) return Monoid::id();
+    const int bl = ql / kBlock;
+    const int br = qr / kBlock;
+    if (bl == br) return inBlock(ql, qr);
+    value_type res = Monoid::op(inBlock(ql, bl * kBlock + kBlock - 1), inBlock(br * kBlock, qr));
+    if (bl + 1 < br) res = Monoid::op(res, block_.query(bl + 1, br - 1));
+    return res;
+  }
+
+  inline int size() const { return n_; }
+};
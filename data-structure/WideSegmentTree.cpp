@@ -0,0 +1,216 @@
+/**
+ * @file WideSegmentTree.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 宽线段树（B叉线段树），用于固定长度数组的单点修改、前缀和/区间和查询
+ *        每个节点有B个子节点，保存子节点的前缀和（不含自身），B个值连续存放且按缓存行对齐
+ *        T = int、B = 16 时一个节点恰好占一个缓存行，树高约为 log16(n)，每层只访问一个缓存行
+ *        查询每层只读一个值；修改时整个节点加上一个掩码后的增量，开启AVX2时用向量加法完成
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <bits/stdc++.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include "FenwickTree.hpp"
+
+template <typename T = int, int B = 16>
+class WideSegmentTree {
+  static_assert(std::is_integral_v<T>, "WideSegmentTree只支持整数");
+  static_assert((B & (B - 1)) == 0, "B必须是2的幂");
+
+  static constexpr size_t kAlign = std::max<size_t>(64, sizeof(T) * B);
+
+  struct alignas(kAlign) Node {
+    T s_[B]{};  // s_[i] 表示前i个子节点的和
+  };
+
+  // mask_[j][i] = (i > j) ? 全1 : 0，修改第j个子节点时，第j个之后的前缀和都要加上增量
+  struct Mask {
+    alignas(kAlign) T m_[B][B]{};
+    constexpr Mask() {
+      for (int j = 0; j < B; j++) {
+        for (int i = 0; i < B; i++) m_[j][i] = i > j ? ~T{} : T{};
+      }
+    }
+  };
+  static constexpr Mask mask_{};
+
+  static constexpr int kLogB = std::__lg(B);
+
+  int n_{};
+  int height_{};             // 层数，第0层的节点直接管辖元素
+  std::vector<int> offset_;  // offset_[h] 为第h层第一个节点在t_中的下标
+  std::vector<Node> t_;      // 所有节点，按层从下到上连续存放
+
+  /**
+   * @brief 对节点node中第j个子节点之后的前缀和加上d
+   */
+  inline static void addSuffix(Node& node, const int j, const T d) {
+#ifdef __AVX2__
+    if constexpr ((sizeof(T) == 4 || sizeof(T) == 8) && sizeof(T) * B % 32 == 0) {
+      constexpr int kVecs = sizeof(T) * B / 32;
+      __m256i dv;
+      if constexpr (sizeof(T) == 4) {
+        dv = _mm256_set1_epi32(static_cast<int>(d));
+      } else {
+        dv = _mm256_set1_epi64x(static_cast<long long>(d));
+      }
+      auto* s = reinterpret_cast<__m256i*>(node.s_);
+      const auto* m = reinterpret_cast<const __m256i*>(mask_.m_[j]);
+      for (int v = 0; v < kVecs; v++) {
+        const __m256i inc = _mm256_and_si256(dv, _mm256_load_si256(m + v));
+        if constexpr (sizeof(T) == 4) {
+          s[v] = _mm256_add_epi32(s[v], inc);
+        } else {
+          s[v] = _mm256_add_epi64(s[v], inc);
+        }
+      }
+      return;
+    }
+#endif
+    for (int i = 0; i < B; i++) node.s_[i] += d & mask_.m_[j][i];
+  }
+
+ public:
+  WideSegmentTree() = default;
+  ~WideSegmentTree() = default;
+
+  explicit WideSegmentTree(const std::vector<T>& v) { build(v); }
+
+  /**
+   * @brief 建树，O(n)：逐层计算每个节点内子节点的前缀和，并把各节点的总和交给上一层
+   *
+   * @param v 目标数组
+   */
+  void build(const std::vector<T>& v) {
+    n_ = static_cast<int>(v.size());
+    offset_.clear();
+    std::vector<Node>().swap(t_);
+
+    // 末尾补一个0，使 prefix(n) 同样落在树内
+    size_t total = 0;
+    height_ = 0;
+    for (long long cnt = n_ + 1; height_ == 0 || cnt > 1; height_++) {
+      offset_.push_back(static_cast<int>(total));
+      cnt = (cnt + B - 1) >> kLogB;
+      total += cnt;
+    }
+    t_.resize(total);
+
+    std::vector<T> cur(v), nxt;
+    cur.push_back(T{});
+    for (int h = 0; h < height_; h++) {
+      const int nodes = (static_cast<int>(cur.size()) + B - 1) >> kLogB;
+      nxt.assign(nodes, T{});
+      for (int k = 0; k < nodes; k++) {
+        Node& node = t_[offset_[h] + k];
+        T sum{};
+        for (int i = 0; i < B; i++) {
+          node.s_[i] = sum;
+          const size_t idx = (static_cast<size_t>(k) << kLogB) + i;
+          if (idx < cur.size()) sum += cur[idx];
+        }
+        nxt[k] = sum;
+      }
+      cur.swap(nxt);
+    }
+  }
+
+  /**
+   * @brief 单点修改，第x个元素加上d
+   *
+   * @param x 元素下标(从0开始)
+   * @param d 变化量
+   */
+  void add(int x, const T d) {
+    for (int h = 0; h < height_; h++, x >>= kLogB) {
+      addSuffix(t_[offset_[h] + (x >> kLogB)], x & (B - 1), d);
+    }
+  }
+
+  /**
+   * @brief 前缀和 a[0] + ... + a[x-1]
+   *
+   * @param x 前缀长度
+   * @return T
+   */
+  T prefix(int x) const {
+    T res{};
+    for (int h = 0; h < height_; h++, x >>= kLogB) {
+      res += t_[offset_[h] + (x >> kLogB)].s_[x & (B - 1)];
+    }
+    return res;
+  }
+
+  /**
+   * @brief 区间求和
+   *
+   * @param ql 待查区间的起始点
+   * @param qr 待查区间的结束点
+   * @return T
+   */
+  inline T query(const int ql, const int qr) const { return prefix(qr + 1) - prefix(ql); }
+
+  inline T get(const int x) const { return query(x, x); }
+
+  inline int size() const { return n_; }
+};
+
+/* -------------------------------------------- 基准测试 -------------------------------------------- */
+// 随机生成长度为n的数组，执行q次操作，一半单点修改、一半前缀查询
+// 与懒标记线段树 SegmentTree 和树状数组 FenwickTree 比较每次操作的平均耗时
+
+template <typename Tree, typename Update, typename Query>
+void bench(const char* name, Tree& tree, const std::vector<std::array<int, 3>>& ops,
+           Update update, Query query) {
+  long long checksum{};
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& [op, x, d] : ops) {
+    if (op == 0) {
+      update(tree, x, d);
+    } else {
+      checksum += query(tree, x);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const double ns = std::chrono::duration<double, std::nano>(end - start).count() / ops.size();
+  printf("%-18s %8.1f ns/op  checksum=%lld\n", name, ns, checksum);
+}
+
+int main() {
+  int n, q;
+  std::cin >> n >> q;
+
+  std::mt19937 gen(20241013);
+  std::vector<int> num(n);
+  for (auto& x : num) x = gen() % 8;
+  std::vector<std::array<int, 3>> ops(q);
+  for (auto& [op, x, d] : ops) {
+    op = gen() & 1;
+    x = gen() % n;
+    d = static_cast<int>(gen() % 8) - 4;
+  }
+
+  WideSegmentTree<int, 16> wide(num);
+  SegmentTree<SumMonoid<int>, AddLazy<int>> seg(num);
+  FenwickTree<int> fenwick(num);
+
+  bench(
+      "WideSegmentTree", wide, ops, [](auto& t, int x, int d) { t.add(x, d); },
+      [](auto& t, int x) { return t.prefix(x + 1); });
+  bench(
+      "SegmentTree", seg, ops, [](auto& t, int x, int d) { t.update(x, x, d); },
+      [](auto& t, int x) { return t.query(0, x); });
+  bench(
+      "FenwickTree", fenwick, ops, [](auto& t, int x, int d) { t.update(x, x, d); },
+      [](auto& t, int x) { return t.query(0, x); });
+
+  return 0;
+}
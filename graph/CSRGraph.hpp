@@ -0,0 +1,134 @@
+/**
+ * @file CSRGraph.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 压缩稀疏行(CSR)存图：只读的带权有向图
+ *        offset_[u] ~ offset_[u + 1] 为顶点u的出边在adj_中的下标范围，所有出边按起点连续存放，
+ *        遍历邻居是一段连续内存的顺序扫描，总内存为 O(V + E)
+ *        由边集经过两趟计数建立：第一趟统计出度并求前缀和，第二趟把每条边放到对应位置
+ *        两个数组既可以由图自己持有，也可以直接指向外部内存（例如 GraphFile.hpp 中mmap映射的文件），
+ *        图对象只保存指针和一个共享的持有者，拷贝图不会拷贝数组
+ * @version 1.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <bits/stdc++.h>
+
+class CSRGraph {
+ public:
+  struct Edge {
+    int u_{};  // 起点
+    int v_{};  // 终点
+    int w_{};  // 权值
+  };
+
+  struct Arc {
+    int v_{};  // 目标点
+    int w_{};  // 权值
+  };
+
+ private:
+  struct Storage {
+    std::vector<int64_t> offset_;
+    std::vector<Arc> adj_;
+  };
+
+  int n_{};                              // 顶点数，编号为 0 ~ n_-1
+  int64_t m_{};                          // 边数
+  const int64_t* offset_{};              // 长度为 n_+1
+  const Arc* adj_{};                     // 按起点排列的所有出边
+  std::shared_ptr<const void> storage_;  // offset_与adj_所指内存的持有者
+
+ public:
+  CSRGraph() = default;
+  ~CSRGraph() = default;
+
+  /**
+   * @brief 直接使用外部内存中的数组建图，不做拷贝
+   *
+   * @param n 顶点数
+   * @param m 边数
+   * @param offset 长度为n+1的偏移数组
+   * @param adj 长度为m的出边数组
+   * @param storage 持有上述内存的对象，图存在期间不会被释放
+   */
+  CSRGraph(const int n, const int64_t m, const int64_t* offset, const Arc* adj,
+           std::shared_ptr<const void> storage)
+      : n_(n), m_(m), offset_(offset), adj_(adj), storage_(std::move(storage)) {}
+
+  /**
+   * @brief 由边集建图
+   *
+   * @param n 顶点数，编号为 0 ~ n-1（1开始编号的图传入 顶点数+1 即可）
+   * @param edges 边集，同一起点的出边保持输入顺序
+   */
+  CSRGraph(const int n, const std::vector<Edge>& edges) : n_(n), m_(edges.size()) {
+    auto storage = std::make_shared<Storage>();
+    auto& offset = storage->offset_;
+    auto& adj = storage->adj_;
+    offset.assign(n + 1, 0);
+    adj.resize(edges.size());
+    for (const auto& e : edges) offset[e.u_ + 1]++;
+    for (int u = 0; u < n_; u++) offset[u + 1] += offset[u];
+    std::vector<int64_t> pos(offset.begin(), offset.end() - 1);
+    for (const auto& e : edges) adj[pos[e.u_]++] = {e.v_, e.w_};
+    offset_ = offset.data();
+    adj_ = adj.data();
+    storage_ = std::move(storage);
+  }
+
+  /**
+   * @brief 从输入流读入m条边 u v w
+   *
+   * @param in 输入流
+   * @param n 顶点数
+   * @param m 边数
+   * @return CSRGraph
+   */
+  static CSRGraph read(std::istream& in, const int n, const int64_t m) {
+    std::vector<Edge> edges(m);
+    for (auto& [u, v, w] : edges) {
+      in >> u >> v >> w;
+    }
+    return CSRGraph(n, edges);
+  }
+
+  /**
+   * @brief 反向图：每条边u->v变为v->u，用于从终点出发的反向搜索
+   *
+   * @return CSRGraph
+   */
+  CSRGraph reverse() const {
+    std::vector<Edge> edges;
+    edges.reserve(m_);
+    for (int u = 0; u < n_; u++) {
+      for (const auto [v, w] : adj(u)) edges.push_back({v, u, w});
+    }
+    return CSRGraph(n_, edges);
+  }
+
+  /**
+   * @brief 顶点u的所有出边
+   *
+   * @param u
+   * @return std::span<const Arc>
+   */
+  inline std::span<const Arc> adj(const int u) const {
+    return {adj_ + offset_[u], adj_ + offset_[u + 1]};
+  }
+
+  inline int degree(const int u) const { return static_cast<int>(offset_[u + 1] - offset_[u]); }
+
+  inline int n() const { return n_; }
+
+  inline int64_t m() const { return m_; }
+
+  // 底层数组，供序列化使用
+  inline const int64_t* offsets() const { return offset_; }
+
+  inline const Arc* arcs() const { return adj_; }
+};
@@ -0,0 +1,108 @@
+/**
+ * @file ContractionHierarchy.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 收缩层次的预处理与查询工具，见 ContractionHierarchy.hpp
+ *        ContractionHierarchy build out.ch [graph.bin] < graph.txt   预处理并保存，图可以是文本或二进制图文件
+ *        ContractionHierarchy query in.ch < queries                  读入q个查询 s t，逐行输出最短路
+ *        ContractionHierarchy --bench                                 比较预处理耗时以及与dijkstra的查询耗时
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "ContractionHierarchy.hpp"
+#include "GraphFile.hpp"
+#include "GraphGenerator.hpp"
+#include "ShortestPathEngine.hpp"
+
+inline double elapsed(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench(const char* name, const CSRGraph& g) {
+  constexpr int Q = 1000;
+  auto start = std::chrono::steady_clock::now();
+  const ContractionHierarchy ch(g);
+  const double build = elapsed(start);
+  ch.save("bench.ch");
+  start = std::chrono::steady_clock::now();
+  const ContractionHierarchy loaded = ContractionHierarchy::load("bench.ch");
+  const double load = elapsed(start);
+  std::remove("bench.ch");
+  printf("%s: %d vertices, %lld edges, preprocessing %.1f ms, load %.1f ms, %lld shortcuts\n", name,
+         g.n() - 1, static_cast<long long>(g.m()), build, load,
+         static_cast<long long>(ch.shortcuts()));
+
+  std::mt19937 gen(20241124);
+  std::vector<std::pair<int, int>> qs(Q);
+  for (auto& [s, t] : qs) {
+    s = gen() % (g.n() - 1) + 1;
+    t = gen() % (g.n() - 1) + 1;
+  }
+
+  Workspace ws(g.n());
+  start = std::chrono::steady_clock::now();
+  long long base = 0;
+  for (const auto& [s, t] : qs) base += ws.dijkstra(g, s, t);
+  const double t1 = elapsed(start);
+
+  CHQuery query(loaded);
+  start = std::chrono::steady_clock::now();
+  long long checksum = 0;
+  for (const auto& [s, t] : qs) checksum += query(s, t);
+  const double t2 = elapsed(start);
+
+  printf("  dijkstra  %10.1f us/query  %9lld settled/query  checksum=%lld\n", t1 * 1000 / Q,
+         ws.settled() / Q, base);
+  printf("  CH        %10.1f us/query  %9lld settled/query  checksum=%lld%s\n", t2 * 1000 / Q,
+         query.settled() / Q, checksum, checksum == base ? "" : "  MISMATCH");
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    // 收缩层次适合道路网这类近似平面、层次分明的图；均匀随机图收缩到后期会形成稠密的核心，预处理很慢
+    bench("grid 300x300", graph_gen::grid(300, 300, 100));
+    return 0;
+  }
+  const std::string mode = argc > 1 ? argv[1] : "";
+  if (argc < 3 || (mode != "build" && mode != "query")) {
+    fprintf(stderr, "usage: %s build <out.ch> [graph.bin] | query <in.ch> | --bench\n", argv[0]);
+    return 1;
+  }
+  std::ios::sync_with_stdio(false);
+
+  try {
+    if (mode == "build") {
+      CSRGraph g;
+      if (argc > 3) {
+        g = graph_file::map(argv[3]);
+      } else {
+        int M, N;  // 顶点数 边数
+        std::cin >> M >> N;
+        g = CSRGraph::read(std::cin, M + 1, N);
+      }
+      const auto start = std::chrono::steady_clock::now();
+      const ContractionHierarchy ch(g);
+      ch.save(argv[2]);
+      fprintf(stderr, "%lld shortcuts, %.1f ms\n", static_cast<long long>(ch.shortcuts()),
+              elapsed(start));
+    } else {
+      const ContractionHierarchy ch = ContractionHierarchy::load(argv[2]);
+      CHQuery query(ch);
+      int q;
+      std::cin >> q;
+      while (q--) {
+        int s, t;
+        std::cin >> s >> t;
+        std::cout << query(s, t) << '\n';
+      }
+    }
+  } catch (const std::exception& e) {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,378 @@
+/**
+ * @file ContractionHierarchy.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 收缩层次(Contraction Hierarchies)：对静态图预处理一次，之后的点对点查询只需搜索很少的顶点
+ *        预处理：按优先级依次收缩顶点。收缩v时，对每对未收缩的邻居 u->v->w，若不经过v就找不到
+ *        不长于 d(u,v)+d(v,w) 的路径（见证搜索），就加入捷径 u->w。优先级为 4 * 边差
+ *        （需要加入的捷径数 - 删去的边数）加上已收缩的邻居数与层数，后两项使收缩在图上分布均匀、层次较浅；
+ *        优先级采用惰性更新：只在取出堆顶时重新计算，若已不是最小则放回，否则直接加入计算时得到的捷径；
+ *        见证搜索在所有目标都确定距离后提前结束
+ *        收缩顺序即顶点的层次，最终的边（原边与捷径）分为两张CSR图：
+ *          up_   u->v 且 v 的层次高于 u
+ *          down_ u->v 且 u 的层次高于 v，反向存为 v->u
+ *        查询：从s在up_上、从t在down_上各做一次只向上的dijkstra，两侧都到达的顶点中距离之和最小者即为答案；
+ *        出队时若能经由更高层次的已访问顶点得到更短的距离，则该顶点不再扩展(stall-on-demand)
+ *        预处理结果可以 save 到文件，之后直接 load
+ *        预处理适合道路网这类近似平面的图（300x300的网格约需数秒）；随机图、社交网络收缩到后期会形成稠密的核心，
+ *        见证搜索与捷径数急剧增加，不适合用本实现预处理
+ * @version 1.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include "CSRGraph.hpp"
+#include "DijkstraQueue.hpp"
+
+class ContractionHierarchy {
+ public:
+  static constexpr int INF = 0x4fffffff;
+
+ private:
+  static constexpr int kWitnessLimit = 500;  // 每次见证搜索最多确定的顶点数，超过则认为没有见证路径
+
+  int n_{};
+  int64_t shortcuts_{};  // 加入的捷径数
+  CSRGraph up_;          // 通往更高层次顶点的边
+  CSRGraph down_;        // 来自更高层次顶点的边，按反向存储
+
+  /**
+   * @brief 预处理时的可修改图，只保留未收缩顶点之间的边，平行边只保留最短的一条
+   *        out_、in_ 按邻居编号排序，加入捷径时二分查找是否已有同向的边
+   */
+  struct Builder {
+    using Arc = CSRGraph::Arc;
+
+    int n_{};
+    std::vector<std::vector<Arc>> out_, in_;
+    std::vector<int> deleted_;  // 已收缩的邻居数
+    std::vector<int> level_;    // 1 + 已收缩的邻居的最大层数，即收缩后v在层次中的深度
+    std::vector<CSRGraph::Edge> up_, down_;
+    int64_t shortcuts_{};
+
+    // 见证搜索用的工作区，距离按代数标记，见 ShortestPathEngine.hpp 中的 Workspace
+    std::vector<int> dis_;
+    std::vector<uint32_t> stamp_;
+    std::vector<uint32_t> target_;  // 等于 gen_ 时为本次见证搜索的目标
+    uint32_t gen_{};
+    IndexedHeap<4> q_;
+
+    // 最近一次 collect 得到的捷径与对应的顶点，收缩时直接使用，不再重复见证搜索
+    std::vector<CSRGraph::Edge> pending_;
+    int pendingOf_{-1};
+
+    explicit Builder(const CSRGraph& g)
+        : n_(g.n()), out_(g.n()), in_(g.n()), deleted_(g.n()), level_(g.n()),
+          dis_(g.n()), stamp_(g.n()), target_(g.n()), q_(g.n(), 0) {
+      for (int u = 0; u < n_; u++) {
+        for (const auto [v, w] : g.adj(u)) {
+          if (u != v) addArc(u, v, w);
+        }
+      }
+    }
+
+    static inline std::vector<Arc>::iterator find(std::vector<Arc>& arcs, const int v) {
+      return std::lower_bound(arcs.begin(), arcs.end(), v,
+                              [](const Arc& a, const int x) { return a.v_ < x; });
+    }
+
+    // 加入边u->v，已有u->v时取较小的权值
+    void addArc(const int u, const int v, const int w) {
+      auto it = find(out_[u], v);
+      if (it != out_[u].end() && it->v_ == v) {
+        if (w < it->w_) {
+          it->w_ = w;
+          find(in_[v], u)->w_ = w;
+        }
+        return;
+      }
+      out_[u].insert(it, {v, w});
+      in_[v].insert(find(in_[v], u), {u, w});
+    }
+
+    inline int dis(const int u) const { return stamp_[u] == gen_ ? dis_[u] : INF; }
+
+    /**
+     * @brief 从s出发、不经过skip的有界dijkstra，skip的出边邻居（除s外）都确定了距离、
+     *        距离超过limit或确定的顶点过多时停止
+     */
+    void witness(const int s, const int skip, const int limit) {
+      q_.clear();
+      if (++gen_ == 0) {
+        std::fill(stamp_.begin(), stamp_.end(), 0);
+        std::fill(target_.begin(), target_.end(), 0);
+        gen_ = 1;
+      }
+      int remaining = 0;
+      for (const auto& a : out_[skip]) {
+        if (a.v_ != s) {
+          target_[a.v_] = gen_;
+          remaining++;
+        }
+      }
+      dis_[s] = 0;
+      stamp_[s] = gen_;
+      q_.push(s, 0);
+      for (int settled = 0; !q_.empty() && settled < kWitnessLimit; settled++) {
+        const auto [d, u] = q_.pop();
+        if (d > limit) break;
+        if (target_[u] == gen_ && --remaining == 0) break;
+        for (const auto [v, w] : out_[u]) {
+          if (v != skip && dis(v) > d + w) {
+            dis_[v] = d + w;
+            stamp_[v] = gen_;
+            q_.push(v, d + w);
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief 求出收缩v需要的捷径，放入 pending_
+     */
+    void collect(const int v) {
+      pending_.clear();
+      pendingOf_ = v;
+      for (const auto [u, wu] : in_[v]) {
+        int maxOut = 0;
+        for (const auto& a : out_[v]) {
+          if (a.v_ != u) maxOut = std::max(maxOut, a.w_);
+        }
+        witness(u, v, wu + maxOut);
+        for (const auto [w, ww] : out_[v]) {
+          if (w != u && dis(w) > wu + ww) pending_.push_back({u, w, wu + ww});
+        }
+      }
+    }
+
+    inline int priority(const int v) {
+      collect(v);
+      const int edges = static_cast<int>(in_[v].size() + out_[v].size());
+      return 4 * (static_cast<int>(pending_.size()) - edges) + deleted_[v] + level_[v];
+    }
+
+    void contract(const int v) {
+      if (pendingOf_ != v) collect(v);
+      for (const auto& [u, w, d] : pending_) addArc(u, w, d);
+      shortcuts_ += pending_.size();
+      pendingOf_ = -1;
+      // v的剩余邻居层次都更高
+      for (const auto [w, ww] : out_[v]) {
+        up_.push_back({v, w, ww});
+        level_[w] = std::max(level_[w], level_[v] + 1);
+        in_[w].erase(find(in_[w], v));
+        deleted_[w]++;
+      }
+      for (const auto [u, wu] : in_[v]) {
+        down_.push_back({v, u, wu});
+        level_[u] = std::max(level_[u], level_[v] + 1);
+        out_[u].erase(find(out_[u], v));
+        deleted_[u]++;
+      }
+      std::vector<Arc>().swap(out_[v]);
+      std::vector<Arc>().swap(in_[v]);
+    }
+
+    void run() {
+      using Item = std::pair<int, int>;  // {优先级, 顶点}
+      std::priority_queue<Item, std::vector<Item>, std::greater<Item>> pq;
+      for (int v = 0; v < n_; v++) pq.emplace(priority(v), v);
+      while (!pq.empty()) {
+        const int v = pq.top().second;
+        pq.pop();
+        const int p = priority(v);  // 惰性更新：只重新计算堆顶的优先级
+        if (!pq.empty() && p > pq.top().first) {  // 优先级已过时
+          pq.emplace(p, v);
+          continue;
+        }
+        contract(v);  // 使用刚才计算优先级时得到的捷径
+      }
+    }
+  };
+
+  static void put(std::ofstream& out, const void* data, const size_t bytes) {
+    out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+  }
+
+  static void get(std::ifstream& in, void* data, const size_t bytes) {
+    in.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes));
+  }
+
+  static void saveGraph(std::ofstream& out, const CSRGraph& g) {
+    const int64_t m = g.m();
+    put(out, &m, sizeof(m));
+    put(out, g.offsets(), sizeof(int64_t) * (g.n() + 1));
+    put(out, g.arcs(), sizeof(CSRGraph::Arc) * m);
+  }
+
+  static CSRGraph loadGraph(std::ifstream& in, const int n) {
+    int64_t m{};
+    get(in, &m, sizeof(m));
+    if (!in || m < 0) throw std::runtime_error("corrupted contraction hierarchy file");
+    auto offset = std::make_shared<std::vector<int64_t>>(n + 1);
+    auto adj = std::make_shared<std::vector<CSRGraph::Arc>>(m);
+    get(in, offset->data(), sizeof(int64_t) * (n + 1));
+    get(in, adj->data(), sizeof(CSRGraph::Arc) * m);
+    if (!in || offset->front() != 0 || offset->back() != m ||
+        !std::is_sorted(offset->begin(), offset->end())) {
+      throw std::runtime_error("corrupted contraction hierarchy file");
+    }
+    const int64_t* pos = offset->data();
+    const CSRGraph::Arc* arcs = adj->data();
+    return CSRGraph(n, m, pos, arcs, std::make_shared<std::pair<decltype(offset), decltype(adj)>>(
+                                         std::move(offset), std::move(adj)));
+  }
+
+ public:
+  ContractionHierarchy() = default;
+
+  /**
+   * @brief 对图g做预处理
+   *
+   * @param g 非负权有向图
+   */
+  explicit ContractionHierarchy(const CSRGraph& g) : n_(g.n()) {
+    Builder builder(g);
+    builder.run();
+    shortcuts_ = builder.shortcuts_;
+    up_ = CSRGraph(n_, builder.up_);
+    down_ = CSRGraph(n_, builder.down_);
+  }
+
+  /**
+   * @brief 保存预处理结果
+   *
+   * @param path 文件路径
+   */
+  void save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("cannot open " + path);
+    const char magic[8]{'C', 'H', 'I', 'N', 'D', 'E', 'X', '1'};
+    put(out, magic, sizeof(magic));
+    put(out, &n_, sizeof(n_));
+    put(out, &shortcuts_, sizeof(shortcuts_));
+    saveGraph(out, up_);
+    saveGraph(out, down_);
+    if (!out) throw std::runtime_error("failed to write " + path);
+  }
+
+  /**
+   * @brief 读入 save 保存的预处理结果
+   *
+   * @param path 文件路径
+   * @return ContractionHierarchy
+   */
+  static ContractionHierarchy load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("cannot open " + path);
+    char magic[8]{};
+    ContractionHierarchy ch;
+    get(in, magic, sizeof(magic));
+    get(in, &ch.n_, sizeof(ch.n_));
+    get(in, &ch.shortcuts_, sizeof(ch.shortcuts_));
+    if (!in || std::memcmp(magic, "CHINDEX1", sizeof(magic)) != 0 || ch.n_ <= 0) {
+      throw std::runtime_error("not a contraction hierarchy file: " + path);
+    }
+    ch.up_ = loadGraph(in, ch.n_);
+    ch.down_ = loadGraph(in, ch.n_);
+    return ch;
+  }
+
+  inline int n() const { return n_; }
+
+  inline int64_t shortcuts() const { return shortcuts_; }
+
+  inline const CSRGraph& up() const { return up_; }
+
+  inline const CSRGraph& down() const { return down_; }
+};
+
+/**
+ * @brief 在收缩层次上查询，持有查询用的工作区，每个线程使用各自的对象
+ */
+class CHQuery {
+ private:
+  static constexpr int INF = ContractionHierarchy::INF;
+
+  const ContractionHierarchy& ch_;
+  std::vector<int> disf_, disb_;         // 正向、反向搜索的距离，仅当对应的 stamp 等于 gen_ 时有效
+  std::vector<uint32_t> stampf_, stampb_;
+  uint32_t gen_{};
+  IndexedHeap<4> qf_, qb_;
+  long long settled_{};  // 累计确定了距离的顶点数
+
+  /**
+   * @brief stall-on-demand：若某个更高层次的顶点x有边x->u且 dis[x]+w < d，则d不是u的真实距离，
+   *        u不在最短路上，不必从u继续扩展
+   *
+   * @param rg 与当前搜索方向相反的图，rg.adj(u) 即所有指向u的、来自更高层次顶点的边
+   */
+  inline bool stalled(const CSRGraph& rg, const std::vector<int>& dis,
+                      const std::vector<uint32_t>& stamp, const int u, const int d) const {
+    for (const auto [x, w] : rg.adj(u)) {
+      if (stamp[x] == gen_ && dis[x] + w < d) return true;
+    }
+    return false;
+  }
+
+ public:
+  explicit CHQuery(const ContractionHierarchy& ch)
+      : ch_(ch), disf_(ch.n()), disb_(ch.n()), stampf_(ch.n()), stampb_(ch.n()),
+        qf_(ch.n(), 0), qb_(ch.n(), 0) {}
+
+  /**
+   * @brief s到t的最短路长度
+   *        每一侧在队首距离不小于当前答案mu时停止，因为只向上搜索，不能在两侧相遇后立即停止
+   *
+   * @return int 最短路长度，不可达时为INF
+   */
+  int operator()(const int s, const int t) {
+    qf_.clear();
+    qb_.clear();
+    if (++gen_ == 0) {
+      std::fill(stampf_.begin(), stampf_.end(), 0);
+      std::fill(stampb_.begin(), stampb_.end(), 0);
+      gen_ = 1;
+    }
+    disf_[s] = 0;
+    stampf_[s] = gen_;
+    qf_.push(s, 0);
+    disb_[t] = 0;
+    stampb_[t] = gen_;
+    qb_.push(t, 0);
+
+    int mu = INF;
+    while (!qf_.empty() || !qb_.empty()) {
+      const bool forward = qb_.empty() || (!qf_.empty() && qf_.top().first <= qb_.top().first);
+      IndexedHeap<4>& q = forward ? qf_ : qb_;
+      if (q.top().first >= mu) {  // 这一侧不可能再找到更短的路径
+        q.clear();
+        continue;
+      }
+      std::vector<int>& dis = forward ? disf_ : disb_;
+      std::vector<uint32_t>& stamp = forward ? stampf_ : stampb_;
+      const std::vector<int>& other = forward ? disb_ : disf_;
+      const std::vector<uint32_t>& otherStamp = forward ? stampb_ : stampf_;
+      const CSRGraph& g = forward ? ch_.up() : ch_.down();
+      const CSRGraph& rg = forward ? ch_.down() : ch_.up();
+
+      const auto [d, u] = q.pop();
+      settled_++;
+      if (otherStamp[u] == gen_) mu = std::min(mu, d + other[u]);
+      if (stalled(rg, dis, stamp, u, d)) continue;
+      for (const auto [v, w] : g.adj(u)) {
+        if (stamp[v] != gen_ || dis[v] > d + w) {  // 松弛
+          dis[v] = d + w;
+          stamp[v] = gen_;
+          q.push(v, d + w);
+        }
+      }
+    }
+    return mu;
+  }
+
+  inline long long settled() const { return settled_; }
+};
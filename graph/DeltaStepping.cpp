@@ -0,0 +1,99 @@
+/**
+ * @file DeltaStepping.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief Δ-stepping 并行单源最短路，见 DeltaStepping.hpp
+ *        DeltaStepping [graph.bin] < input   与 dijkstra-2 相同的输入，输出顶点1到顶点M的最短路
+ *        DeltaStepping --bench               与串行dijkstra比较不同Δ与线程数的耗时
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "DeltaStepping.hpp"
+#include "DijkstraQueue.hpp"
+#include "GraphFile.hpp"
+#include "GraphGenerator.hpp"
+
+/**
+ * @brief 对照组：串行dijkstra，求出所有顶点的最短路
+ */
+std::vector<int> dijkstra(const CSRGraph& g, const int s) {
+  std::vector<int> dis(g.n(), DeltaStepping::INF);
+  IndexedHeap<4> q(g.n(), 0);
+  dis[s] = 0;
+  q.push(s, 0);
+  while (!q.empty()) {
+    const auto [d, u] = q.pop();
+    for (const auto [v, w] : g.adj(u)) {
+      if (dis[v] > d + w) {
+        dis[v] = d + w;
+        q.push(v, d + w);
+      }
+    }
+  }
+  return dis;
+}
+
+inline double elapsed(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench(const char* name, const CSRGraph& g) {
+  printf("%s: %d vertices, %lld edges\n", name, g.n() - 1, static_cast<long long>(g.m()));
+  auto start = std::chrono::steady_clock::now();
+  const std::vector<int> base = dijkstra(g, 1);
+  printf("  %-24s %10.1f ms\n", "dijkstra", elapsed(start));
+
+  std::vector<int> threads{1, 2, 4, static_cast<int>(std::thread::hardware_concurrency())};
+  std::sort(threads.begin(), threads.end());
+  threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+  for (const int delta : {10, 50, 200, 1000}) {
+    for (const int T : threads) {
+      DeltaStepping sssp(g, delta, T);
+      start = std::chrono::steady_clock::now();
+      const std::vector<int> dis = sssp(1);
+      const double t = elapsed(start);
+      char label[48];
+      snprintf(label, sizeof(label), "delta=%d, %d thread%s", delta, T, T > 1 ? "s" : "");
+      printf("  %-24s %10.1f ms  %6d phases  %10lld relaxations%s\n", label, t, sssp.phases(),
+             sssp.relaxations(), dis == base ? "" : "  MISMATCH");
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    printf("%d hardware threads\n", std::thread::hardware_concurrency());
+    bench("grid 1000x1000", graph_gen::grid(1000, 1000, 100));
+    bench("random", graph_gen::random(1000000, 8000000, 100));
+    return 0;
+  }
+  std::ios::sync_with_stdio(false);
+  int M;  // 顶点数
+  CSRGraph g;
+  try {
+    if (argc > 1) {
+      g = graph_file::map(argv[1]);
+      M = g.n() - 1;
+    } else {
+      int N;  // 边数
+      std::cin >> M >> N;
+      g = CSRGraph::read(std::cin, M + 1, N);
+    }
+  } catch (const std::exception& e) {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+
+  // Δ取 最大边权/平均出度，轻边阶段的重复松弛与阶段数比较均衡
+  int maxW = 1;
+  for (int u = 0; u < g.n(); u++) {
+    for (const auto& a : g.adj(u)) maxW = std::max(maxW, a.w_);
+  }
+  DeltaStepping sssp(g, static_cast<int>(1.0 * maxW * g.n() / std::max<int64_t>(1, g.m())));
+  std::cout << sssp(1)[M] << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,220 @@
+/**
+ * @file DeltaStepping.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief Δ-stepping 并行单源最短路，结果与 dijkstra 求出的 dis[] 相同
+ *        把距离按宽度Δ分桶，第i个桶存放距离在 [iΔ, (i+1)Δ) 内的顶点，按桶的顺序处理：
+ *          轻边阶段：反复取出当前桶中的顶点并松弛其轻边（w <= Δ），新的距离可能仍落在当前桶，直到当前桶为空
+ *          重边阶段：对本桶中确定的所有顶点松弛一次重边（w > Δ），重边只会进入之后的桶
+ *        同一阶段内的顶点由多个线程并行松弛，距离用CAS取最小值，松弛成功的顶点放入该线程自己的桶中，
+ *        阶段之间由 std::barrier 同步，并在同步点把各线程的当前桶合并为下一阶段的任务
+ *        Δ越小越接近dijkstra（阶段多、无用的松弛少），Δ越大越接近Bellman-Ford（阶段少、并行度高）
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include "CSRGraph.hpp"
+
+class DeltaStepping {
+ public:
+  static constexpr int INF = 0x4fffffff;
+
+ private:
+  static constexpr size_t kChunk = 256;  // 每次从任务中领取的顶点数
+
+  const CSRGraph& g_;
+  const int delta_;
+  const int threads_;
+  int maxW_{};
+
+  // 每个顶点的出边按轻边在前、重边在后重新排列，mid_[u] 为顶点u第一条重边的位置
+  std::vector<CSRGraph::Arc> arcs_;
+  std::vector<int64_t> mid_;
+
+  // 一次运行中的状态
+  std::vector<std::atomic<int>> dis_;
+  std::vector<std::atomic<int>> relaxed_;  // 顶点的轻边最近一次以哪个距离松弛过，避免重复松弛
+  std::vector<std::atomic<int>> bucket_;   // 顶点最近一次在哪个桶中被取出，用于收集重边阶段的顶点
+
+  struct alignas(64) Local {
+    std::vector<std::vector<int>> bucket_;  // 循环使用的桶，下标为 桶号 % 桶数
+    std::vector<int> settled_;              // 本桶中取出的顶点，重边阶段使用
+    long long relaxations_{};
+  };
+  std::vector<Local> local_;
+
+  std::vector<int> frontier_;  // 当前阶段需要处理的顶点
+  std::atomic<size_t> next_{};
+  int64_t cur_{};  // 当前桶号
+  bool heavy_{};   // 当前是否为重边阶段
+  bool done_{};
+  int phases_{};
+
+  template <typename F>
+  void parallel(F f) const {
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads_; t++) pool.emplace_back(f, t);
+    f(0);
+    for (auto& th : pool) th.join();
+  }
+
+  inline size_t slot(const int64_t b) const { return b % local_[0].bucket_.size(); }
+
+  inline void relax(Local& local, const int v, const int d) {
+    int old = dis_[v].load(std::memory_order_relaxed);
+    while (d < old) {
+      if (dis_[v].compare_exchange_weak(old, d, std::memory_order_relaxed)) {
+        local.bucket_[slot(d / delta_)].push_back(v);
+        local.relaxations_++;
+        return;
+      }
+    }
+  }
+
+  void work(Local& local) {
+    const int64_t* offset = g_.offsets();
+    for (size_t lo; (lo = next_.fetch_add(kChunk)) < frontier_.size();) {
+      const size_t hi = std::min(lo + kChunk, frontier_.size());
+      for (size_t i = lo; i < hi; i++) {
+        const int u = frontier_[i];
+        const int d = dis_[u].load(std::memory_order_relaxed);
+        if (heavy_) {
+          for (int64_t j = mid_[u]; j < offset[u + 1]; j++) {
+            relax(local, arcs_[j].v_, d + arcs_[j].w_);
+          }
+          continue;
+        }
+        // 过期元素：u的距离已经减小到之前的桶中，或者已经以当前距离松弛过
+        if (d / delta_ != cur_ || relaxed_[u].exchange(d, std::memory_order_relaxed) == d) continue;
+        if (bucket_[u].exchange(static_cast<int>(cur_), std::memory_order_relaxed) != cur_) {
+          local.settled_.push_back(u);
+        }
+        for (int64_t j = offset[u]; j < mid_[u]; j++) relax(local, arcs_[j].v_, d + arcs_[j].w_);
+      }
+    }
+  }
+
+  // 把各线程第b个桶中的顶点移到frontier_中
+  void gather(const int64_t b) {
+    for (auto& local : local_) {
+      auto& bucket = local.bucket_[slot(b)];
+      frontier_.insert(frontier_.end(), bucket.begin(), bucket.end());
+      bucket.clear();
+    }
+  }
+
+  // 所有线程到达同步点后由其中一个线程执行：准备下一阶段的任务
+  void step() {
+    frontier_.clear();
+    next_ = 0;
+    phases_++;
+    if (!heavy_) {
+      gather(cur_);
+      if (!frontier_.empty()) return;
+      heavy_ = true;  // 当前桶已空，转入重边阶段
+      for (auto& local : local_) {
+        frontier_.insert(frontier_.end(), local.settled_.begin(), local.settled_.end());
+        local.settled_.clear();
+      }
+      if (!frontier_.empty()) return;
+    }
+    heavy_ = false;  // 寻找下一个非空的桶，所有元素都在 [cur_, cur_ + 桶数) 内
+    const int64_t last = cur_ + static_cast<int64_t>(local_[0].bucket_.size());
+    for (cur_++; cur_ < last; cur_++) {
+      gather(cur_);
+      if (!frontier_.empty()) return;
+    }
+    done_ = true;
+  }
+
+ public:
+  /**
+   * @brief 构造，并把每个顶点的出边划分为轻边和重边
+   *
+   * @param g 非负权有向图
+   * @param delta 桶宽Δ，不小于1；桶数为 最大边权/Δ + 2
+   * @param threads 线程数
+   */
+  DeltaStepping(const CSRGraph& g, const int delta,
+                const int threads = std::thread::hardware_concurrency())
+      : g_(g), delta_(std::max(1, delta)), threads_(std::max(1, threads)), arcs_(g.m()),
+        mid_(g.n()), dis_(g.n()), relaxed_(g.n()), bucket_(g.n()), local_(threads_) {
+    const int n = g.n();
+    std::vector<int> maxW(threads_);
+    parallel([&](const int t) {
+      const int lo = static_cast<int>(1LL * n * t / threads_);
+      const int hi = static_cast<int>(1LL * n * (t + 1) / threads_);
+      for (int u = lo; u < hi; u++) {
+        int64_t j = g.offsets()[u];
+        for (const auto& a : g.adj(u)) {
+          if (a.w_ <= delta_) arcs_[j++] = a;
+        }
+        mid_[u] = j;
+        for (const auto& a : g.adj(u)) {
+          if (a.w_ > delta_) arcs_[j++] = a;
+        }
+        for (const auto& a : g.adj(u)) maxW[t] = std::max(maxW[t], a.w_);
+      }
+    });
+    maxW_ = *std::max_element(maxW.begin(), maxW.end());
+    // 松弛得到的距离不超过 当前桶的上界 + 最大边权，循环使用 maxW/Δ + 2 个桶即可
+    for (auto& local : local_) local.bucket_.resize(maxW_ / delta_ + 2);
+  }
+
+  /**
+   * @brief 求源点s到所有顶点的最短路
+   *
+   * @param s 源点
+   * @return std::vector<int> 最短路长度，不可达时为INF
+   */
+  std::vector<int> operator()(const int s) {
+    const int n = g_.n();
+    parallel([&](const int t) {
+      const int lo = static_cast<int>(1LL * n * t / threads_);
+      const int hi = static_cast<int>(1LL * n * (t + 1) / threads_);
+      for (int u = lo; u < hi; u++) {
+        dis_[u].store(INF, std::memory_order_relaxed);
+        relaxed_[u].store(-1, std::memory_order_relaxed);
+        bucket_[u].store(-1, std::memory_order_relaxed);
+      }
+    });
+    for (auto& local : local_) local.relaxations_ = 0;
+    dis_[s] = 0;
+    frontier_.assign(1, s);
+    next_ = 0;
+    cur_ = 0;
+    heavy_ = false;
+    done_ = false;
+    phases_ = 0;
+
+    std::barrier sync(threads_, [this]() noexcept { step(); });
+    parallel([&](const int t) {
+      while (!done_) {
+        work(local_[t]);
+        sync.arrive_and_wait();
+      }
+    });
+
+    std::vector<int> dis(n);
+    for (int u = 0; u < n; u++) dis[u] = dis_[u].load(std::memory_order_relaxed);
+    return dis;
+  }
+
+  inline int delta() const { return delta_; }
+
+  inline int maxWeight() const { return maxW_; }
+
+  // 最近一次运行的阶段数
+  inline int phases() const { return phases_; }
+
+  // 最近一次运行中成功松弛的次数
+  long long relaxations() const {
+    long long total = 0;
+    for (const auto& local : local_) total += local.relaxations_;
+    return total;
+  }
+};
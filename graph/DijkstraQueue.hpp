@@ -0,0 +1,227 @@
+/**
+ * @file DijkstraQueue.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief Dijkstra算法可选的优先队列
+ *        所有队列都提供相同的接口，作为 dijkstra 的模板参数使用：
+ *          Queue(n, max_w)   n为顶点数，max_w为最大边权
+ *          push(u, d)        顶点u的距离变为d（插入或减小）
+ *          pop()             弹出距离最小的 {d, u}
+ *          empty()
+ *        LazyQueue 与 IndexedHeap 还提供 top() 查看最小的 {d, u}，双向搜索的终止条件需要用到
+ *        LazyQueue：std::priority_queue，每次松弛都压入新元素，出队时由调用者跳过过期元素，堆大小为 O(E)
+ *        IndexedHeap：带位置索引的D叉堆，松弛时原地减小键值，堆中最多V个元素；clear() 只重置堆中剩余的顶点，
+ *                     同一个堆可以在多次查询间复用
+ *        RadixHeap：基数堆，利用出队键值单调不减，按与上次出队键值的最高不同位分桶，适用于任意非负整数边权
+ *        DialQueue：Dial桶队列，max_w+1个循环桶，每个桶对应一个距离，适用于较小的非负整数边权
+ *        后两者同样由调用者跳过过期元素
+ * @version 1.2
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <bits/stdc++.h>
+
+class LazyQueue {
+ private:
+  struct Node {
+    int dis_{};  // 源点到目标点的路径长度
+    int u_{};    // 该节点所表示图上的顶点编号
+
+    bool operator>(const Node& x) const { return dis_ > x.dis_; }
+  };
+
+  std::priority_queue<Node, std::vector<Node>, std::greater<Node>> q_{};  // 基于路径长度的最小堆
+
+ public:
+  LazyQueue(const int, const int) {}
+
+  inline void push(const int u, const int d) { q_.emplace(d, u); }
+
+  inline std::pair<int, int> pop() {
+    const Node node = q_.top();
+    q_.pop();
+    return {node.dis_, node.u_};
+  }
+
+  inline std::pair<int, int> top() const { return {q_.top().dis_, q_.top().u_}; }
+
+  inline bool empty() const { return q_.empty(); }
+};
+
+template <int D = 4>
+class IndexedHeap {
+  static_assert(D >= 2);
+
+ private:
+  struct Node {
+    int key_{};  // 距离
+    int u_{};    // 顶点编号
+  };
+
+  std::vector<Node> heap_;  // 堆，heap_[0]为堆顶，节点i的子节点为 D*i+1 ~ D*i+D
+  std::vector<int> pos_;    // pos_[u] 为顶点u在堆中的位置，不在堆中为-1
+
+  inline void place(const int i, const Node& node) {
+    heap_[i] = node;
+    pos_[node.u_] = i;
+  }
+
+  // 上浮
+  inline void siftUp(int i) {
+    const Node node = heap_[i];
+    while (i > 0) {
+      const int p = (i - 1) / D;
+      if (heap_[p].key_ <= node.key_) break;
+      place(i, heap_[p]);
+      i = p;
+    }
+    place(i, node);
+  }
+
+  // 下沉：在D个子节点中找到最小的一个
+  inline void siftDown(int i) {
+    const Node node = heap_[i];
+    const int n = static_cast<int>(heap_.size());
+    while (true) {
+      const int first = D * i + 1;
+      if (first >= n) break;
+      const int last = std::min(first + D, n);
+      int c = first;
+      for (int j = first + 1; j < last; j++) {
+        if (heap_[j].key_ < heap_[c].key_) c = j;
+      }
+      if (heap_[c].key_ >= node.key_) break;
+      place(i, heap_[c]);
+      i = c;
+    }
+    place(i, node);
+  }
+
+ public:
+  IndexedHeap(const int n, const int) : pos_(n, -1) { heap_.reserve(n); }
+
+  /**
+   * @brief 插入顶点u，若u已在堆中则把它的键值减小为d
+   *
+   * @param u 顶点
+   * @param d 新的距离
+   */
+  inline void push(const int u, const int d) {
+    if (pos_[u] < 0) {
+      heap_.push_back({d, u});
+      siftUp(static_cast<int>(heap_.size()) - 1);
+    } else {
+      decreaseKey(u, d);
+    }
+  }
+
+  /**
+   * @brief 把顶点u的键值减小为d，d不小于原键值时忽略
+   *
+   * @param u 堆中的顶点
+   * @param d 新的距离
+   */
+  inline void decreaseKey(const int u, const int d) {
+    const int i = pos_[u];
+    if (d >= heap_[i].key_) return;
+    heap_[i].key_ = d;
+    siftUp(i);
+  }
+
+  inline std::pair<int, int> pop() {
+    const Node top = heap_[0];
+    pos_[top.u_] = -1;
+    const Node last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+      place(0, last);
+      siftDown(0);
+    }
+    return {top.key_, top.u_};
+  }
+
+  inline std::pair<int, int> top() const { return {heap_[0].key_, heap_[0].u_}; }
+
+  /**
+   * @brief 清空堆，代价与堆中剩余元素个数成正比，而不是顶点数
+   */
+  inline void clear() {
+    for (const auto& node : heap_) pos_[node.u_] = -1;
+    heap_.clear();
+  }
+
+  inline bool empty() const { return heap_.empty(); }
+
+  inline size_t size() const { return heap_.size(); }
+};
+
+class RadixHeap {
+ private:
+  using Node = std::pair<uint32_t, int>;  // {距离, 顶点}
+
+  // bucket_[i] 中的键值与 last_ 的最高不同位为第i-1位，bucket_[0] 中的键值等于 last_
+  std::array<std::vector<Node>, 33> bucket_;
+  uint32_t last_{};  // 上一次出队的键值
+  size_t size_{};
+
+  inline int index(const uint32_t key) const { return std::bit_width(key ^ last_); }
+
+ public:
+  RadixHeap(const int, const int) {}
+
+  inline void push(const int u, const int d) {
+    bucket_[index(d)].emplace_back(d, u);
+    size_++;
+  }
+
+  /**
+   * @brief bucket_[0]为空时，取第一个非空桶中的最小键值作为新的last_，并把该桶重新分配到更低的桶中
+   *        每个元素只会往更低的桶移动，均摊 O(log C)
+   */
+  inline std::pair<int, int> pop() {
+    if (bucket_[0].empty()) {
+      int i = 1;
+      while (bucket_[i].empty()) i++;
+      last_ = std::min_element(bucket_[i].begin(), bucket_[i].end())->first;
+      for (const auto& node : bucket_[i]) bucket_[index(node.first)].push_back(node);
+      bucket_[i].clear();
+    }
+    const Node node = bucket_[0].back();
+    bucket_[0].pop_back();
+    size_--;
+    return {static_cast<int>(node.first), node.second};
+  }
+
+  inline bool empty() const { return size_ == 0; }
+};
+
+class DialQueue {
+ private:
+  // 队列中的键值都落在 [cur_, cur_ + max_w] 内，键值d放在第 d % (max_w + 1) 个桶中
+  std::vector<std::vector<int>> bucket_;
+  int cur_{};  // 当前扫描到的距离
+  size_t size_{};
+
+ public:
+  DialQueue(const int, const int max_w) : bucket_(max_w + 1) {}
+
+  inline void push(const int u, const int d) {
+    bucket_[d % bucket_.size()].push_back(u);
+    size_++;
+  }
+
+  inline std::pair<int, int> pop() {
+    while (bucket_[cur_ % bucket_.size()].empty()) cur_++;
+    auto& b = bucket_[cur_ % bucket_.size()];
+    const int u = b.back();
+    b.pop_back();
+    size_--;
+    return {cur_, u};
+  }
+
+  inline bool empty() const { return size_ == 0; }
+};
@@ -0,0 +1,78 @@
+/**
+ * @file DynamicSSSP.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 边权变化时增量维护最短路，见 DynamicSSSP.hpp
+ *        DynamicSSSP < input   输入 M N 与N条边，再输入q条修改 u v w，每条修改后输出顶点1到顶点M的最短路
+ *        DynamicSSSP --bench   比较每批修改后增量更新与重新运行dijkstra的耗时
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "DynamicSSSP.hpp"
+#include "GraphGenerator.hpp"
+
+inline double elapsed(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench() {
+  constexpr int R = 1000, C = 1000, B = 20;
+  const CSRGraph g = graph_gen::grid(R, C, 100);
+  std::vector<CSRGraph::Edge> edges;
+  for (int u = 1; u < g.n(); u++) {
+    for (const auto [v, w] : g.adj(u)) edges.push_back({u, v, w});
+  }
+  auto start = std::chrono::steady_clock::now();
+  DynamicSSSP sssp(g, 1);
+  printf("grid %dx%d, initial dijkstra %.1f ms, %d batches per size\n", R, C, elapsed(start), B);
+
+  std::mt19937 gen(20241124);
+  for (const int size : {1, 10, 100, 1000}) {
+    double incremental = 0, full = 0;
+    long long touched = 0;
+    bool ok = true;
+    for (int b = 0; b < B; b++) {
+      // 随机选出若干条边，新的权值在原权值的一半到两倍之间，变大变小的都有
+      std::vector<CSRGraph::Edge> batch(size);
+      for (auto& e : batch) {
+        auto& [u, v, w] = edges[gen() % edges.size()];
+        w = std::clamp<int>(w * (50 + gen() % 151) / 100, 1, 200);
+        e = {u, v, w};
+      }
+      start = std::chrono::steady_clock::now();
+      sssp.update(batch);
+      incremental += elapsed(start);
+      touched += sssp.touched();
+      start = std::chrono::steady_clock::now();
+      const std::vector<int> dis = sssp.recompute();
+      full += elapsed(start);
+      ok &= dis == sssp.dis();
+    }
+    printf("  %4d edges/batch: incremental %9.3f ms  full %9.3f ms  %9lld touched/batch%s\n",
+           size, incremental / B, full / B, touched / B, ok ? "" : "  MISMATCH");
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    bench();
+    return 0;
+  }
+  std::ios::sync_with_stdio(false);
+  int M, N;  // 顶点数 边数
+  std::cin >> M >> N;
+  DynamicSSSP sssp(CSRGraph::read(std::cin, M + 1, N), 1);
+  int q;
+  std::cin >> q;
+  while (q--) {
+    int u, v, w;
+    std::cin >> u >> v >> w;
+    sssp.update({{u, v, w}});
+    std::cout << sssp.dis(M) << '\n';
+  }
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file DynamicSSSP.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 边权变化时增量维护固定源点的最短路 dis[] 与最短路树
+ *        一批修改（插入边、改变边权）先全部写入图中，再分两类处理（Ramalingam–Reps）：
+ *          变大：树边 p->v 的权值变大后，v子树中所有顶点的距离都可能失效。把整棵子树标记为受影响，
+ *                距离置为INF，再由未受影响的入边邻居给出暂定距离放入堆中
+ *          变小/插入：u->v 使 dis[u] + w < dis[v] 时，更新v并放入堆中
+ *        最后从堆中的顶点出发做一次dijkstra，只有距离真正改变的顶点会被松弛
+ *        未受影响的顶点的距离对应一条不经过变大边的路径，仍是合法的上界，所以只需从上述顶点出发，
+ *        代价与受影响区域的大小（及其出入边数）成正比，而不是 V+E
+ *        每条修改边还要线性查找 out_[u]、in_[v] 中已有的边，为 O(deg(u) + deg(v))；构造时按起点一次合并平行边，O(V + E)
+ * @version 1.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include "CSRGraph.hpp"
+#include "DijkstraQueue.hpp"
+
+class DynamicSSSP {
+ public:
+  static constexpr int INF = 0x4fffffff;
+
+ private:
+  using Arc = CSRGraph::Arc;
+
+  int n_{};
+  int s_{};
+  std::vector<std::vector<Arc>> out_, in_;  // 可修改的图，平行边只保留权值最小的一条
+  std::vector<int> dis_;
+  std::vector<int> parent_;  // 最短路树中的父节点，源点与不可达的顶点为-1
+  std::vector<char> affected_;
+  IndexedHeap<4> q_;
+  long long touched_{};  // 最近一次修改中距离被重置或被更新的次数
+
+  // 设置u->v的权值，不存在时插入
+  void setArc(const int u, const int v, const int w) {
+    for (auto& a : out_[u]) {
+      if (a.v_ == v) {
+        a.w_ = w;
+        for (auto& b : in_[v]) {
+          if (b.v_ == u) b.w_ = w;
+        }
+        return;
+      }
+    }
+    out_[u].push_back({v, w});
+    in_[v].push_back({u, w});
+  }
+
+  // u->v 的当前权值
+  inline int weight(const int u, const int v) const {
+    for (const auto& a : out_[u]) {
+      if (a.v_ == v) return a.w_;
+    }
+    return INF;
+  }
+
+  // 从堆中的顶点出发的dijkstra
+  void propagate() {
+    while (!q_.empty()) {
+      const auto [d, u] = q_.pop();
+      for (const auto [v, w] : out_[u]) {
+        if (d + w < dis_[v]) {  // 松弛
+          dis_[v] = d + w;
+          parent_[v] = u;
+          q_.push(v, d + w);
+          touched_++;
+        }
+      }
+    }
+  }
+
+ public:
+  /**
+   * @brief 构造并求出初始的最短路
+   *
+   * @param g 初始图，边权非负
+   * @param s 源点
+   */
+  DynamicSSSP(const CSRGraph& g, const int s)
+      : n_(g.n()), s_(s), out_(g.n()), in_(g.n()), dis_(g.n(), INF), parent_(g.n(), -1),
+        affected_(g.n()), q_(g.n(), 0) {
+    // 按起点合并平行边：pos[v] 为u->v在 out_[u] 中的下标，处理完u后复位，O(V + E)
+    std::vector<int> pos(n_, -1);
+    for (int u = 0; u < n_; u++) {
+      auto& out = out_[u];
+      for (const auto [v, w] : g.adj(u)) {
+        if (w >= INF) continue;
+        if (pos[v] < 0) {
+          pos[v] = static_cast<int>(out.size());
+          out.push_back({v, w});
+        } else {
+          out[pos[v]].w_ = std::min(out[pos[v]].w_, w);
+        }
+      }
+      for (const auto& a : out) {
+        pos[a.v_] = -1;
+        in_[a.v_].push_back({u, a.w_});
+      }
+    }
+    dis_[s] = 0;
+    q_.push(s, 0);
+    propagate();
+  }
+
+  /**
+   * @brief 应用一批修改并更新最短路
+   *
+   * @param batch 每条 {u, v, w} 把边u->v的权值设为w（w非负），边不存在时插入
+   */
+  void update(const std::vector<CSRGraph::Edge>& batch) {
+    touched_ = 0;
+    q_.clear();
+    for (const auto& e : batch) setArc(e.u_, e.v_, e.w_);
+    // 同一条边可能在一批中出现多次，以下都使用最终的权值
+    std::vector<CSRGraph::Edge> edges(batch);
+    for (auto& e : edges) e.w_ = weight(e.u_, e.v_);
+
+    // 权值变大的树边：收集子树中的所有顶点
+    std::vector<int> affected;
+    for (const auto& [u, v, w] : edges) {
+      if (parent_[v] == u && dis_[u] + w > dis_[v] && !affected_[v]) {
+        affected_[v] = 1;
+        affected.push_back(v);
+      }
+    }
+    for (size_t i = 0; i < affected.size(); i++) {
+      const int x = affected[i];
+      for (const auto& a : out_[x]) {
+        if (parent_[a.v_] == x && !affected_[a.v_]) {
+          affected_[a.v_] = 1;
+          affected.push_back(a.v_);
+        }
+      }
+    }
+    for (const int v : affected) {
+      dis_[v] = INF;
+      parent_[v] = -1;
+    }
+    // 受影响的顶点从未受影响的入边邻居得到暂定距离
+    for (const int v : affected) {
+      for (const auto [x, w] : in_[v]) {
+        if (!affected_[x] && dis_[x] < INF && dis_[x] + w < dis_[v]) {
+          dis_[v] = dis_[x] + w;
+          parent_[v] = x;
+        }
+      }
+      if (dis_[v] < INF) q_.push(v, dis_[v]);
+    }
+    touched_ += affected.size();
+    for (const int v : affected) affected_[v] = 0;
+
+    // 权值变小或新插入的边
+    for (const auto& [u, v, w] : edges) {
+      if (dis_[u] < INF && dis_[u] + w < dis_[v]) {
+        dis_[v] = dis_[u] + w;
+        parent_[v] = u;
+        q_.push(v, dis_[v]);
+        touched_++;
+      }
+    }
+    propagate();
+  }
+
+  inline int dis(const int v) const { return dis_[v]; }
+
+  inline const std::vector<int>& dis() const { return dis_; }
+
+  inline int parent(const int v) const { return parent_[v]; }
+
+  inline int source() const { return s_; }
+
+  // 最近一次修改中距离被重置或被更新的次数
+  inline long long touched() const { return touched_; }
+
+  /**
+   * @brief 当前图上从源点出发的完整dijkstra，用于对照
+   */
+  std::vector<int> recompute() const {
+    std::vector<int> dis(n_, INF);
+    IndexedHeap<4> q(n_, 0);
+    dis[s_] = 0;
+    q.push(s_, 0);
+    while (!q.empty()) {
+      const auto [d, u] = q.pop();
+      for (const auto [v, w] : out_[u]) {
+        if (d + w < dis[v]) {
+          dis[v] = d + w;
+          q.push(v, d + w);
+        }
+      }
+    }
+    return dis;
+  }
+};
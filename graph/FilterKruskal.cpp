@@ -0,0 +1,196 @@
+/**
+ * @file FilterKruskal.cpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief Filter-Kruskal 最小生成森林与连通分量
+ *        Kruskal需要先对所有边排序，而权值大的边往往两端早已连通，排序它们是浪费
+ *        Filter-Kruskal 以随机边权为基准把边分成轻、重两半，先递归处理轻边，再过滤掉两端已连通的重边，
+ *        只对剩下的重边继续递归；划分和过滤都由多个线程完成，边数较少时退化为普通Kruskal
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include "../data-structure/DisjointSet.hpp"
+
+struct Edge {
+  int u_{};  // 起点
+  int v_{};  // 终点
+  int w_{};  // 权值
+};
+
+struct Forest {
+  long long weight_{};       // 最小生成森林的总权值
+  std::vector<Edge> edges_;  // 森林中的边
+  int components_{};         // 连通分量个数
+  long long comparisons_{};  // 排序时比较的次数
+};
+
+class FilterKruskal {
+ private:
+  static constexpr size_t kBase = 1 << 12;      // 边数不超过kBase时直接排序
+  static constexpr size_t kParallel = 1 << 16;  // 边数不少于kParallel时才多线程划分
+
+  int n_{};
+  int threads_{};
+  ConcurrentDisjointSet dsu_;
+  Forest forest_;
+  std::vector<Edge> buf_;  // 划分时的临时数组
+  std::mt19937 gen_{20241127};
+
+  /**
+   * @brief 把[first, first + m)中满足pred的边稳定地移到前面
+   *        每个线程先统计自己那一段中满足条件的边数，求前缀和后各自写入临时数组，最后拷回
+   *
+   * @return size_t 满足pred的边数
+   */
+  template <typename Pred>
+  size_t partition(Edge* first, const size_t m, Edge* buf, Pred pred) {
+    if (m < kParallel || threads_ == 1) {
+      return std::stable_partition(first, first + m, pred) - first;
+    }
+    const int T = threads_;
+    const size_t chunk = (m + T - 1) / T;
+    std::vector<size_t> cnt(T + 1);
+    auto parallel = [T](auto f) {
+      std::vector<std::thread> pool;
+      for (int t = 1; t < T; t++) pool.emplace_back(f, t);
+      f(0);
+      for (auto& th : pool) th.join();
+    };
+    parallel([&](const int t) {
+      const size_t lo = std::min(m, t * chunk), hi = std::min(m, lo + chunk);
+      cnt[t + 1] = std::count_if(first + lo, first + hi, pred);
+    });
+    for (int t = 0; t < T; t++) cnt[t + 1] += cnt[t];
+    const size_t total = cnt[T];
+    parallel([&](const int t) {
+      const size_t lo = std::min(m, t * chunk), hi = std::min(m, lo + chunk);
+      size_t yes = cnt[t];
+      size_t no = total + lo - cnt[t];
+      for (size_t i = lo; i < hi; i++) buf[pred(first[i]) ? yes++ : no++] = first[i];
+    });
+    parallel([&](const int t) {
+      const size_t lo = std::min(m, t * chunk), hi = std::min(m, lo + chunk);
+      std::copy(buf + lo, buf + hi, first + lo);
+    });
+    return total;
+  }
+
+  /**
+   * @brief 按权值排序后依次合并，即普通的Kruskal
+   */
+  void kruskal(Edge* first, const size_t m) {
+    std::sort(first, first + m, [this](const Edge& a, const Edge& b) {
+      forest_.comparisons_++;
+      return a.w_ < b.w_;
+    });
+    unite(first, m);
+  }
+
+  inline void unite(Edge* first, const size_t m) {
+    for (size_t i = 0; i < m; i++) {
+      if (dsu_.unite(first[i].u_, first[i].v_)) {
+        forest_.weight_ += first[i].w_;
+        forest_.edges_.push_back(first[i]);
+      }
+    }
+  }
+
+  void solve(Edge* first, size_t m, Edge* buf) {
+    if (m <= kBase) {
+      kruskal(first, m);
+      return;
+    }
+    const int pivot = first[gen_() % m].w_;
+    size_t light = partition(first, m, buf, [pivot](const Edge& e) { return e.w_ <= pivot; });
+    if (light == m) {  // 基准恰好是最大值，改为严格小于，把最大权值的边单独分出来
+      light = partition(first, m, buf, [pivot](const Edge& e) { return e.w_ < pivot; });
+      if (light == 0) {  // 所有边权值相同，不需要排序
+        unite(first, m);
+        return;
+      }
+    }
+    solve(first, light, buf);
+    // 过滤：两端已经连通的重边不可能进入生成森林
+    first += light;
+    buf += light;
+    m -= light;
+    m = partition(first, m, buf, [this](const Edge& e) { return !dsu_.same(e.u_, e.v_); });
+    solve(first, m, buf);
+  }
+
+ public:
+  /**
+   * @brief 构造
+   *
+   * @param n 顶点数，顶点编号为 1 ~ n
+   * @param threads 线程数
+   */
+  explicit FilterKruskal(const int n, const int threads = std::thread::hardware_concurrency())
+      : n_(n), threads_(std::max(1, threads)), dsu_(n + 1) {}
+
+  /**
+   * @brief 求最小生成森林，会打乱edges的顺序
+   *
+   * @param edges 边集
+   * @return Forest
+   */
+  Forest operator()(std::vector<Edge>& edges) {
+    buf_.resize(edges.size());
+    solve(edges.data(), edges.size(), buf_.data());
+    forest_.components_ = n_ - static_cast<int>(forest_.edges_.size());
+    return std::move(forest_);
+  }
+};
+
+/**
+ * @brief 对照组：先排序所有边，再串行合并
+ */
+Forest kruskal(const int n, std::vector<Edge> edges) {
+  Forest forest;
+  CompactDisjointSet dsu(n + 1);
+  std::sort(edges.begin(), edges.end(), [&](const Edge& a, const Edge& b) {
+    forest.comparisons_++;
+    return a.w_ < b.w_;
+  });
+  for (const auto& e : edges) {
+    if (!dsu.same(e.u_, e.v_)) {
+      dsu.unite(e.u_, e.v_);
+      forest.weight_ += e.w_;
+      forest.edges_.push_back(e);
+    }
+  }
+  forest.components_ = n - static_cast<int>(forest.edges_.size());
+  return forest;
+}
+
+inline double elapsed(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+  int n, m;  // n个点 m条边
+  std::cin >> n >> m;
+  std::vector<Edge> edges(m);
+  for (auto& [u, v, w] : edges) {
+    std::cin >> u >> v >> w;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  const Forest base = kruskal(n, edges);
+  const double t1 = elapsed(start);
+
+  start = std::chrono::steady_clock::now();
+  const Forest forest = FilterKruskal(n)(edges);
+  const double t2 = elapsed(start);
+
+  std::cout << forest.weight_ << ' ' << forest.edges_.size() << ' ' << forest.components_ << '\n';
+  fprintf(stderr, "kruskal:        %10.1f ms  %12lld comparisons  weight=%lld\n", t1,
+          base.comparisons_, base.weight_);
+  fprintf(stderr, "filter-kruskal: %10.1f ms  %12lld comparisons  weight=%lld\n", t2,
+          forest.comparisons_, forest.weight_);
+
+  return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file GraphFile.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief CSR图的二进制文件格式，加载时用mmap直接映射为 CSRGraph，不拷贝、不解析
+ *        文件布局（小端序，各段起始位置按64字节对齐）：
+ *          [0, 64)                 文件头 GraphFileHeader
+ *          [offset_pos_, ...)      偏移数组，(n+1) 个 int64
+ *          [adj_pos_, ...)         出边数组，m 个 {int32 v, int32 w}
+ *        加载时总会检查文件头中的各段不越界，以及 offsets[0] == 0、offsets[n] == m；
+ *        文件头还记录了两个数组的64位校验和，verify 时再检查偏移数组单调、出边目标点不越界与校验和（需要读完整个文件）
+ * @version 1.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CSRGraph.hpp"
+
+struct GraphFileHeader {
+  char magic_[8]{'C', 'S', 'R', 'G', 'R', 'A', 'P', 'H'};
+  uint32_t version_{1};
+  uint32_t header_size_{sizeof(GraphFileHeader)};
+  int64_t n_{};            // 顶点数
+  int64_t m_{};            // 边数
+  uint64_t offset_pos_{};  // 偏移数组在文件中的起始位置
+  uint64_t adj_pos_{};     // 出边数组在文件中的起始位置
+  uint64_t checksum_{};    // 两个数组的校验和
+  uint64_t reserved_{};
+};
+static_assert(sizeof(GraphFileHeader) == 64);
+static_assert(sizeof(CSRGraph::Arc) == 8);
+
+namespace graph_file {
+
+constexpr uint64_t kAlign = 64;
+
+inline uint64_t align(const uint64_t x) { return (x + kAlign - 1) & ~(kAlign - 1); }
+
+/**
+ * @brief 按8字节为单位的乘法-异或校验和，可以在已有的值h上继续累加
+ */
+inline uint64_t checksum(const void* data, const size_t bytes,
+                         uint64_t h = 0x84222325CBF29CE4ULL) {
+  const auto* p = static_cast<const unsigned char*>(data);
+  size_t i = 0;
+  for (; i + 8 <= bytes; i += 8) {
+    uint64_t w;
+    std::memcpy(&w, p + i, 8);
+    h = (h ^ w) * 0x100000001B3ULL;
+    h ^= h >> 29;
+  }
+  for (; i < bytes; i++) h = (h ^ p[i]) * 0x100000001B3ULL;
+  return h;
+}
+
+inline uint64_t checksum(const CSRGraph& g) {
+  const uint64_t h = checksum(g.offsets(), sizeof(int64_t) * (g.n() + 1));
+  return checksum(g.arcs(), sizeof(CSRGraph::Arc) * g.m(), h);
+}
+
+/**
+ * @brief 把图写入二进制文件
+ *
+ * @param g 图
+ * @param path 文件路径
+ */
+inline void write(const CSRGraph& g, const std::string& path) {
+  GraphFileHeader header;
+  header.n_ = g.n();
+  header.m_ = g.m();
+  header.offset_pos_ = align(sizeof(GraphFileHeader));
+  header.adj_pos_ = align(header.offset_pos_ + sizeof(int64_t) * (g.n() + 1));
+  header.checksum_ = checksum(g);
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) throw std::runtime_error("cannot open " + path);
+  const std::vector<char> zero(kAlign, 0);
+  const auto pad = [&](const uint64_t pos) {
+    out.write(zero.data(), static_cast<std::streamsize>(pos - static_cast<uint64_t>(out.tellp())));
+  };
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  pad(header.offset_pos_);
+  out.write(reinterpret_cast<const char*>(g.offsets()), sizeof(int64_t) * (g.n() + 1));
+  pad(header.adj_pos_);
+  out.write(reinterpret_cast<const char*>(g.arcs()), sizeof(CSRGraph::Arc) * g.m());
+  if (!out) throw std::runtime_error("failed to write " + path);
+}
+
+/**
+ * @brief 把二进制文件映射到内存并作为 CSRGraph 使用，映射在最后一个图对象析构时解除
+ *
+ * @param path 文件路径
+ * @param verify 是否检查数组内容与校验和
+ * @return CSRGraph
+ */
+inline CSRGraph map(const std::string& path, const bool verify = false) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("cannot open " + path);
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(GraphFileHeader)) {
+    ::close(fd);
+    throw std::runtime_error("not a graph file: " + path);
+  }
+  const size_t bytes = st.st_size;
+  void* addr = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) throw std::runtime_error("cannot mmap " + path);
+  std::shared_ptr<const void> storage(addr, [bytes](const void* p) {
+    ::munmap(const_cast<void*>(p), bytes);
+  });
+
+  const auto* base = static_cast<const char*>(addr);
+  const auto* header = reinterpret_cast<const GraphFileHeader*>(base);
+  const GraphFileHeader expect;
+  // 各段的位置与长度都先检查不越界，再做除法比较，避免很大的 n_、m_ 使乘法溢出
+  if (std::memcmp(header->magic_, expect.magic_, sizeof(expect.magic_)) != 0 ||
+      header->version_ != expect.version_ || header->header_size_ != sizeof(GraphFileHeader) ||
+      header->n_ <= 0 || header->n_ > std::numeric_limits<int>::max() || header->m_ < 0 ||
+      header->offset_pos_ % kAlign || header->adj_pos_ % kAlign ||
+      header->offset_pos_ < sizeof(GraphFileHeader) || header->offset_pos_ > header->adj_pos_ ||
+      header->adj_pos_ > bytes ||
+      static_cast<uint64_t>(header->n_) + 1 > (header->adj_pos_ - header->offset_pos_) / sizeof(int64_t) ||
+      static_cast<uint64_t>(header->m_) > (bytes - header->adj_pos_) / sizeof(CSRGraph::Arc)) {
+    throw std::runtime_error("corrupted graph file header: " + path);
+  }
+
+  const int n = static_cast<int>(header->n_);
+  const int64_t m = header->m_;
+  const auto* offset = reinterpret_cast<const int64_t*>(base + header->offset_pos_);
+  const auto* adj = reinterpret_cast<const CSRGraph::Arc*>(base + header->adj_pos_);
+  if (offset[0] != 0 || offset[n] != m) {  // O(1)，不校验时也检查
+    throw std::runtime_error("corrupted graph file offsets: " + path);
+  }
+  if (verify) {  // 偏移数组单调不减，出边的目标点在 0 ~ n-1 内
+    for (int u = 0; u < n; u++) {
+      if (offset[u] > offset[u + 1]) throw std::runtime_error("corrupted graph file offsets: " + path);
+    }
+    for (int64_t i = 0; i < m; i++) {
+      if (adj[i].v_ < 0 || adj[i].v_ >= n) throw std::runtime_error("corrupted graph file arcs: " + path);
+    }
+  }
+
+  CSRGraph g(n, m, offset, adj, std::move(storage));
+  if (verify && checksum(g) != header->checksum_) {
+    throw std::runtime_error("graph file checksum mismatch: " + path);
+  }
+  return g;
+}
+
+}  // namespace graph_file
@@ -0,0 +1,76 @@
+/**
+ * @file GraphGenerator.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 基准测试用的随机图，顶点编号均为 1 ~ n
+ *        grid：网格图，相邻格子之间有双向边，近似道路网
+ *        random：端点均匀随机的有向图
+ *        power-law：端点按幂律分布选取的有向图，少数顶点的度数远大于其余顶点，近似社交网络
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include "CSRGraph.hpp"
+
+namespace graph_gen {
+
+/**
+ * @brief rows * cols 的网格图
+ */
+inline CSRGraph grid(const int rows, const int cols, const int max_w, const uint32_t seed = 1) {
+  std::mt19937 gen(seed);
+  std::vector<CSRGraph::Edge> edges;
+  edges.reserve(4LL * rows * cols);
+  const auto id = [cols](const int r, const int c) { return r * cols + c + 1; };
+  for (int r = 0; r < rows; r++) {
+    for (int c = 0; c < cols; c++) {
+      if (c + 1 < cols) {
+        const int w = gen() % max_w + 1;
+        edges.push_back({id(r, c), id(r, c + 1), w});
+        edges.push_back({id(r, c + 1), id(r, c), w});
+      }
+      if (r + 1 < rows) {
+        const int w = gen() % max_w + 1;
+        edges.push_back({id(r, c), id(r + 1, c), w});
+        edges.push_back({id(r + 1, c), id(r, c), w});
+      }
+    }
+  }
+  return CSRGraph(rows * cols + 1, edges);
+}
+
+/**
+ * @brief n个顶点、m条边的均匀随机有向图
+ */
+inline CSRGraph random(const int n, const int64_t m, const int max_w, const uint32_t seed = 1) {
+  std::mt19937 gen(seed);
+  std::vector<CSRGraph::Edge> edges(m);
+  for (auto& [u, v, w] : edges) {
+    u = gen() % n + 1;
+    v = gen() % n + 1;
+    w = gen() % max_w + 1;
+  }
+  return CSRGraph(n + 1, edges);
+}
+
+/**
+ * @brief n个顶点、m条边的幂律图：端点取 n * x^3（x在[0, 1)上均匀分布），编号小的顶点是枢纽
+ */
+inline CSRGraph powerLaw(const int n, const int64_t m, const int max_w, const uint32_t seed = 1) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  const auto skew = [&]() { return static_cast<int>(n * std::pow(unit(gen), 3.0)) % n + 1; };
+  std::vector<CSRGraph::Edge> edges(m);
+  for (auto& [u, v, w] : edges) {
+    u = skew();
+    v = gen() % 2 ? skew() : static_cast<int>(gen() % n) + 1;
+    w = gen() % max_w + 1;
+  }
+  return CSRGraph(n + 1, edges);
+}
+
+}  // namespace graph_gen
@@ -0,0 +1,214 @@
+/**
+ * @file GraphLoader.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 多线程读入文本格式的图并建立CSR
+ *        文本格式与 CSRGraph::read 相同：M N，之后N行 u v w，顶点编号为 1 ~ M；M N 与边之间可以是任意空白
+ *        解析：把整段文本按换行切成线程数个块，各线程用 std::from_chars 解析自己块中的三元组，得到各自的边表；
+ *              若某块中的数不是3的倍数（一行中不止一条边等不规则的格式），退回单线程解析，
+ *              整段中的数仍不是3的倍数时说明有不完整的边，抛出异常
+ *        建图：各线程先统计自己边表中每个起点的出边数（每个线程一个直方图），对每个顶点按线程顺序求前缀和，
+ *              再对顶点分段求前缀和得到偏移数组，最后各线程把自己的边写到各自的位置上；
+ *              同一起点的出边保持输入顺序，结果与 CSRGraph(n, edges) 完全相同
+ *        直方图占 线程数 * 顶点数 个 uint32，顶点数很大时应适当减少线程数
+ * @version 1.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "CSRGraph.hpp"
+
+namespace graph_load {
+
+template <typename F>
+inline void parallel(const int threads, F f) {
+  std::vector<std::thread> pool;
+  for (int t = 1; t < threads; t++) pool.emplace_back(f, t);
+  f(0);
+  for (auto& th : pool) th.join();
+}
+
+/**
+ * @brief 解析[first, last)中的整数，放入out，遇到非法字符时返回false
+ */
+inline bool parseInts(const char* first, const char* last, std::vector<int>& out) {
+  while (true) {
+    while (first < last && std::isspace(static_cast<unsigned char>(*first))) first++;
+    if (first == last) return true;
+    int x;
+    const auto [p, ec] = std::from_chars(first, last, x);
+    if (ec != std::errc()) return false;
+    out.push_back(x);
+    first = p;
+  }
+}
+
+/**
+ * @brief 由各线程的边表并行建立CSR
+ *
+ * @param n 顶点数
+ * @param parts parts[t] 为第t个线程的边表，按t的顺序拼接即为输入顺序
+ * @return CSRGraph
+ */
+inline CSRGraph build(const int n, const std::vector<std::vector<CSRGraph::Edge>>& parts) {
+  const int T = static_cast<int>(parts.size());
+  const auto range = [n, T](const int t) {
+    return std::pair<int, int>(static_cast<int>(1LL * n * t / T),
+                               static_cast<int>(1LL * n * (t + 1) / T));
+  };
+  auto storage = std::make_shared<std::pair<std::vector<int64_t>, std::vector<CSRGraph::Arc>>>();
+  auto& [offset, adj] = *storage;
+  offset.assign(n + 1, 0);
+  std::vector<std::vector<uint32_t>> hist(T);  // hist[t][u]：第t个线程中起点为u的边数
+  std::vector<int64_t> sum(T + 1);             // 各线程负责的顶点段中的边数
+
+  parallel(T, [&](const int t) {
+    hist[t].assign(n, 0);
+    for (const auto& e : parts[t]) hist[t][e.u_]++;
+  });
+  // 对每个顶点按线程求前缀和：hist[t][u] 变为第t个线程的边在顶点u的出边中的起始位置
+  parallel(T, [&](const int t) {
+    const auto [lo, hi] = range(t);
+    for (int u = lo; u < hi; u++) {
+      int64_t run = 0;
+      for (int k = 0; k < T; k++) {
+        const uint32_t c = hist[k][u];
+        hist[k][u] = static_cast<uint32_t>(run);
+        run += c;
+      }
+      offset[u + 1] = run;
+      sum[t + 1] += run;
+    }
+  });
+  for (int t = 0; t < T; t++) sum[t + 1] += sum[t];
+  parallel(T, [&](const int t) {
+    const auto [lo, hi] = range(t);
+    int64_t run = sum[t];
+    for (int u = lo; u < hi; u++) {
+      run += offset[u + 1];
+      offset[u + 1] = run;
+    }
+  });
+  adj.resize(sum[T]);
+  parallel(T, [&](const int t) {
+    for (const auto& e : parts[t]) adj[offset[e.u_] + hist[t][e.u_]++] = {e.v_, e.w_};
+  });
+
+  const int64_t* pos = offset.data();
+  const CSRGraph::Arc* arcs = adj.data();
+  return CSRGraph(n, sum[T], pos, arcs, std::move(storage));
+}
+
+/**
+ * @brief 解析整段文本并建图
+ *
+ * @param text 文本
+ * @param threads 线程数
+ * @return CSRGraph 顶点数为 M+1
+ */
+inline CSRGraph parse(const std::string_view text, const int threads = std::thread::hardware_concurrency()) {
+  const char* first = text.data();
+  const char* last = text.data() + text.size();
+  // M N，与 std::cin >> M >> N 一样允许任意空白分隔，第二个数之后即为边
+  int header[2]{};
+  const char* body = first;
+  for (int& x : header) {
+    while (body < last && std::isspace(static_cast<unsigned char>(*body))) body++;
+    const auto [p, ec] = std::from_chars(body, last, x);
+    if (ec != std::errc() || x < 0) throw std::runtime_error("bad graph header");
+    body = p;
+  }
+  const int M = header[0];
+  const int64_t N = header[1];
+
+  // 按换行把剩余文本切成T块
+  const int T = std::max(1, threads);
+  std::vector<const char*> cut(T + 1, last);
+  cut[0] = body;
+  for (int t = 1; t < T; t++) {
+    const char* p = std::max(cut[t - 1], body + (last - body) * t / T);
+    cut[t] = std::min(last, std::find(p, last, '\n'));
+  }
+
+  std::vector<std::vector<CSRGraph::Edge>> parts(T);
+  std::atomic<bool> regular{true}, valid{true};
+  parallel(T, [&](const int t) {
+    std::vector<int> ints;
+    ints.reserve((cut[t + 1] - cut[t]) / 6);
+    if (!parseInts(cut[t], cut[t + 1], ints)) valid = false;
+    if (ints.size() % 3) regular = false;
+    auto& edges = parts[t];
+    edges.resize(ints.size() / 3);
+    for (size_t i = 0; i < edges.size(); i++) edges[i] = {ints[3 * i], ints[3 * i + 1], ints[3 * i + 2]};
+  });
+  if (!valid) throw std::runtime_error("bad character in graph");
+  if (!regular) {  // 不规则的格式，整体重新解析
+    std::vector<int> ints;
+    if (!parseInts(body, last, ints)) throw std::runtime_error("bad character in graph");
+    if (ints.size() % 3) throw std::runtime_error("incomplete edge");
+    parts.assign(1, {});
+    parts[0].resize(ints.size() / 3);
+    for (size_t i = 0; i < parts[0].size(); i++) {
+      parts[0][i] = {ints[3 * i], ints[3 * i + 1], ints[3 * i + 2]};
+    }
+  }
+
+  // 只取前N条边，检查顶点编号
+  int64_t total = 0;
+  for (auto& edges : parts) {
+    if (total + static_cast<int64_t>(edges.size()) > N) edges.resize(N - total);
+    total += edges.size();
+  }
+  if (total < N) throw std::runtime_error("graph has fewer edges than declared");
+  parallel(static_cast<int>(parts.size()), [&](const int t) {
+    for (const auto& e : parts[t]) {
+      if (e.u_ < 0 || e.u_ > M || e.v_ < 0 || e.v_ > M) valid = false;
+    }
+  });
+  if (!valid) throw std::runtime_error("vertex out of range");
+
+  return build(M + 1, parts);
+}
+
+/**
+ * @brief 读入整个输入流后解析
+ */
+inline CSRGraph read(std::istream& in, const int threads = std::thread::hardware_concurrency()) {
+  const std::string text(std::istreambuf_iterator<char>(in), {});
+  return parse(text, threads);
+}
+
+/**
+ * @brief 把文本文件映射到内存后解析
+ */
+inline CSRGraph file(const std::string& path, const int threads = std::thread::hardware_concurrency()) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("cannot open " + path);
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+    ::close(fd);
+    throw std::runtime_error("empty graph file: " + path);
+  }
+  const size_t bytes = st.st_size;
+  void* addr = ::mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) throw std::runtime_error("cannot mmap " + path);
+  try {
+    CSRGraph g = parse({static_cast<const char*>(addr), bytes}, threads);
+    ::munmap(addr, bytes);
+    return g;
+  } catch (...) {
+    ::munmap(addr, bytes);
+    throw;
+  }
+}
+
+}  // namespace graph_load
@@ -0,0 +1,188 @@
+/**
+ * @file ShortestPathEngine.hpp
+ * @author LyBin (lybin1336258176@outlook.com)
+ * @brief 多线程批量最短路查询
+ *        dijkstra-1/dijkstra-2 中的 dis、vis 和队列都是全局变量，每次查询都要 O(V) 地清空，也无法并发查询
+ *        这里把一次查询需要的状态放进工作区 Workspace，每个线程持有一个；工作区记录当前的查询代数，
+ *        dis_[u] 只在 stamp_[u] 等于当前代数时有效，开始新查询只需把代数加一，重置代价为 O(1)
+ *        （队列的清空代价与上次查询剩下的元素个数成正比，不超过上次查询本身的代价）
+ *        ShortestPathEngine 持有一个常驻线程池，所有线程共享同一个只读的 CSRGraph，批量查询按块分给各线程
+ * @version 1.0
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#pragma once
+
+#include "CSRGraph.hpp"
+#include "DijkstraQueue.hpp"
+
+/**
+ * @brief 一个线程执行查询所需的全部状态，不同线程使用不同的工作区即可并发查询
+ */
+class Workspace {
+ public:
+  static constexpr int INF = 0x4fffffff;
+
+ private:
+  std::vector<int> dis_;          // 当前查询中各顶点的距离，仅当 stamp_[u] == gen_ 时有效
+  std::vector<uint32_t> stamp_;   // 各顶点最近一次被访问时的查询代数
+  uint32_t gen_{};                // 当前查询代数
+  IndexedHeap<4> q_;              // 堆中不会出现过期元素，出堆的顶点最短路即已确定
+  long long settled_{};           // 累计确定了最短路的顶点数
+
+  inline void reset() {
+    q_.clear();
+    if (++gen_ == 0) {  // 代数回绕，此时才真正清空一次
+      std::fill(stamp_.begin(), stamp_.end(), 0);
+      gen_ = 1;
+    }
+  }
+
+  inline int dis(const int u) const { return stamp_[u] == gen_ ? dis_[u] : INF; }
+
+ public:
+  explicit Workspace(const int n) : dis_(n), stamp_(n), q_(n, 0) {}
+
+  /**
+   * @brief 在图g上求s到t的最短路，终点出队后立即返回
+   *
+   * @param g 图，顶点数需与构造时一致
+   * @param s 起点
+   * @param t 终点
+   * @return int 最短路长度，不可达时为INF
+   */
+  int dijkstra(const CSRGraph& g, const int s, const int t) {
+    reset();
+    dis_[s] = 0;
+    stamp_[s] = gen_;
+    q_.push(s, 0);
+    while (!q_.empty()) {
+      const auto [d, u] = q_.pop();
+      settled_++;
+      if (u == t) return d;
+      for (const auto [v, w] : g.adj(u)) {
+        if (dis(v) > d + w) {  // 松弛
+          dis_[v] = d + w;
+          stamp_[v] = gen_;
+          q_.push(v, d + w);
+        }
+      }
+    }
+    return INF;
+  }
+
+  inline long long settled() const { return settled_; }
+};
+
+class ShortestPathEngine {
+ public:
+  static constexpr int INF = Workspace::INF;
+
+ private:
+  static constexpr size_t kChunk = 16;  // 每次从批中领取的查询数
+
+  const CSRGraph& g_;
+  std::vector<Workspace> ws_;  // ws_[i] 属于第i个线程，ws_[0] 由调用 query 的线程使用
+  std::vector<std::thread> pool_;
+
+  std::mutex call_;                 // 同一时刻只处理一批查询
+  std::mutex mutex_;                // 保护下面的批次状态
+  std::condition_variable start_;   // 通知工作线程有新的批次
+  std::condition_variable finish_;  // 通知调用者所有工作线程已完成
+  uint64_t batch_{};                // 批次编号
+  int running_{};                   // 尚未完成当前批次的工作线程数
+  bool stop_{};
+
+  const std::vector<std::pair<int, int>>* qs_{};
+  std::vector<int>* res_{};
+  std::atomic<size_t> next_{};  // 下一个未被领取的查询
+
+  void work(Workspace& ws) {
+    const auto& qs = *qs_;
+    auto& res = *res_;
+    for (size_t lo; (lo = next_.fetch_add(kChunk)) < qs.size();) {
+      const size_t hi = std::min(lo + kChunk, qs.size());
+      for (size_t i = lo; i < hi; i++) res[i] = ws.dijkstra(g_, qs[i].first, qs[i].second);
+    }
+  }
+
+  void worker(const int id) {
+    uint64_t seen = 0;
+    while (true) {
+      std::unique_lock lock(mutex_);
+      start_.wait(lock, [&]() { return stop_ || batch_ != seen; });
+      if (stop_) return;
+      seen = batch_;
+      lock.unlock();
+      work(ws_[id]);
+      lock.lock();
+      if (--running_ == 0) finish_.notify_one();
+    }
+  }
+
+ public:
+  /**
+   * @brief 构造，启动 threads-1 个工作线程
+   *
+   * @param g 图，引擎存在期间需保持有效
+   * @param threads 线程数
+   */
+  explicit ShortestPathEngine(const CSRGraph& g,
+                              const int threads = std::thread::hardware_concurrency())
+      : g_(g) {
+    const int T = std::max(1, threads);
+    ws_.reserve(T);
+    for (int i = 0; i < T; i++) ws_.emplace_back(g.n());
+    for (int i = 1; i < T; i++) pool_.emplace_back(&ShortestPathEngine::worker, this, i);
+  }
+
+  ShortestPathEngine(const ShortestPathEngine&) = delete;
+  ShortestPathEngine& operator=(const ShortestPathEngine&) = delete;
+
+  ~ShortestPathEngine() {
+    {
+      std::lock_guard lock(mutex_);
+      stop_ = true;
+    }
+    start_.notify_all();
+    for (auto& t : pool_) t.join();
+  }
+
+  /**
+   * @brief 批量查询，可以从多个线程调用，各批次依次执行
+   *
+   * @param qs 查询 {起点, 终点}
+   * @return std::vector<int> 各查询的最短路长度，不可达时为INF
+   */
+  std::vector<int> query(const std::vector<std::pair<int, int>>& qs) {
+    std::lock_guard call(call_);
+    std::vector<int> res(qs.size());
+    qs_ = &qs;
+    res_ = &res;
+    next_ = 0;
+    {
+      std::lock_guard lock(mutex_);
+      running_ = static_cast<int>(pool_.size());
+      batch_++;
+    }
+    start_.notify_all();
+    work(ws_[0]);
+    std::unique_lock lock(mutex_);
+    finish_.wait(lock, [&]() { return running_ == 0; });
+    return res;
+  }
+
+  inline int threads() const { return static_cast<int>(ws_.size()); }
+
+  /**
+   * @brief 所有线程累计确定了最短路的顶点数
+   */
+  long long settled() const {
+    long long total = 0;
+    for (const auto& ws : ws_) total += ws.settled();
+    return total;
+  }
+};
@@ -2,68 +2,136 @@
  * @file dijkstra-1.cpp
  * @author LyBin (lybin1336258176@outlook.com)
  * @brief 暴力Dijkstra
- * @version 1.0
- * @date 2024-11-24
+ *        图以CSR格式存储，见 CSRGraph.hpp；命令行给出二进制图文件时直接映射该文件，见 GraphFile.hpp
+ *        指定终点时，终点的最短路确定后立即返回
+ *        找最小值使用 DenseDijkstra.hpp 中的向量化扫描，已确定的顶点并入距离数组；
+ *        E/V^2 足够大时改用邻接矩阵上的稠密版本，dijkstra-1 --bench 比较它与堆优化版本的分界点
+ * @version 1.3
+ * @date 2026-10-17
  * 
  * @copyright Copyright (c) 2024
  * 
  */
 
-#include <bits/stdc++.h>
+#include "DenseDijkstra.hpp"
+#include "DijkstraQueue.hpp"
+#include "GraphFile.hpp"
+#include "GraphGenerator.hpp"
 
-constexpr int MaxN = 1e5;
 constexpr int INF = 0x4fffffff;
 
-struct Edge {
-  int v, w;
-};
-
 int M, N;
-int vis[MaxN];
-int dis[MaxN];
-std::vector<Edge> e[MaxN];
+std::vector<uint32_t> key;  // 未确定的顶点到源点的当前距离，已确定的顶点为 dense::kSettled（即vis）
+std::vector<int> dis;
+CSRGraph g;
 
+/**
+ * @brief dijkstra算法
+ *
+ * @param s 起点
+ * @param t 终点，为0时求出所有顶点的最短路
+ * @return int 最短路长度
+ */
 int dijkstra(int s, int t) {
-  // init
-  for (int i = 1; i <= M; i++) {
-    dis[i] = INF;
-    vis[i] = 0;
-  }
+  // init，key的长度对齐到向量宽度，多出的位置与不存在的0号顶点都视为已确定
+  const int stride = (M + dense::kWidth) / dense::kWidth * dense::kWidth;
+  key.assign(stride, dense::kSettled);
+  std::fill(key.begin() + 1, key.begin() + M + 1, INF);
+  dis.assign(M + 1, INF);
 
-  dis[s] = 0;
+  key[s] = 0;
   for (int i = 1; i <= M; i++) {  // 由于有M个顶点，所以找到从源点到每个顶点的最短路需要M次遍历
-    int u = 0;
-    int mind = INF;
-
     // 遍历所有顶点，找到距离源点最短的顶点u
-    for (int j = 1; j <= M; j++) {
-      if (!vis[j] && dis[j] < mind) {
-        u = j;
-        mind = dis[j];
+    const int u = dense::argmin(key.data(), stride);
+    const uint32_t du = key[u];
+
+    if (du >= INF) break;  // 剩余顶点均不可达
+    dis[u] = static_cast<int>(du);
+    key[u] = dense::kSettled;
+    if (u == t) break;  // 终点的最短路已经确定
+    for (const auto [v, w] : g.adj(u)) {  // 遍历顶点u的所有出边
+      if (key[v] != dense::kSettled && key[v] > du + w) {  // 松弛
+        key[v] = du + w;
       }
     }
+  }
+  return dis[t];
+}
 
-    vis[u] = 1;
-    for (auto edge : e[u]) {  // 遍历顶点u的所有出边
-      int v = edge.v;
-      int w = edge.w;
-      if (dis[v] > dis[u] + w) {  // 松弛
-        dis[v] = dis[u] + w;
+/* -------------------------------------------- 基准测试 -------------------------------------------- */
+/**
+ * @brief 对照组：堆优化的dijkstra
+ */
+int heapDijkstra(int s, int t) {
+  dis.assign(M + 1, INF);
+  IndexedHeap<4> q(M + 1, 0);
+  dis[s] = 0;
+  q.push(s, 0);
+  while (!q.empty()) {
+    const auto [d, u] = q.pop();
+    if (u == t) break;
+    for (const auto [v, w] : g.adj(u)) {
+      if (dis[v] > d + w) {
+        dis[v] = d + w;
+        q.push(v, d + w);
       }
     }
   }
   return dis[t];
 }
 
-int main() {
-  std::cin >> M >> N;
-  for (int i = 0; i < N; i++) {
-    int u, v, w;
-    std::cin >> u >> v >> w;
-    e[u].emplace_back(v, w);
+/**
+ * @brief 固定顶点数，逐渐增加边数，比较堆、逐个扫描与稠密版本的耗时，找出 E/V^2 的分界点
+ */
+void bench() {
+  constexpr int V = 4000, R = 5;
+  printf("V=%d, %d full runs each, dense::kDenseRatio=%.3f\n", V, R, dense::kDenseRatio);
+  printf("%8s %10s %12s %12s %12s\n", "E/V^2", "E", "heap ms", "scan ms", "dense ms");
+  for (const double ratio : {0.01, 0.05, 0.1, 0.2, 0.3, 0.5, 1.0, 2.0}) {
+    g = graph_gen::random(V, static_cast<int64_t>(ratio * V * V), 100);
+    M = V;
+    DenseDijkstra solver(g);
+    double t[3]{};
+    long long checksum[3]{};
+    for (int r = 1; r <= R; r++) {
+      const auto time = [&](const int k, auto f) {
+        const auto start = std::chrono::steady_clock::now();
+        f(r, 0);
+        t[k] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                    .count();
+        checksum[k] += std::accumulate(dis.begin() + 1, dis.end(), 0LL);
+      };
+      time(0, heapDijkstra);
+      time(1, dijkstra);
+      time(2, [&](int s, int u) {
+        solver(s, u);
+        dis = solver.dis();
+      });
+    }
+    printf("%8.3f %10lld %12.2f %12.2f %12.2f%s\n", ratio, static_cast<long long>(g.m()), t[0] / R,
+           t[1] / R, t[2] / R,
+           checksum[0] == checksum[1] && checksum[0] == checksum[2] ? "" : "  MISMATCH");
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    bench();
+    return 0;
+  }
+  if (argc > 1) {
+    g = graph_file::map(argv[1]);
+    M = g.n() - 1;
+  } else {
+    std::cin >> M >> N;
+    g = CSRGraph::read(std::cin, M + 1, N);
   }
 
-  std::cout << dijkstra(1, M) << '\n';
+  if (dense::prefer(g)) {  // 稠密图使用邻接矩阵与向量化的松弛
+    std::cout << DenseDijkstra(g)(1, M) << '\n';
+  } else {
+    std::cout << dijkstra(1, M) << '\n';
+  }
   
   return 0;
 }
@@ -2,75 +2,223 @@
  * @file dijkstra-2.cpp
  * @author LyBin (lybin1336258176@outlook.com)
  * @brief 优先队列实现dijkstra算法
- * @version 1.0
- * @date 2024-11-24
+ *        图以CSR格式存储，见 CSRGraph.hpp；命令行给出二进制图文件时直接映射该文件，见 GraphFile.hpp
+ *        优先队列作为模板参数，可选的队列见 DijkstraQueue.hpp；dijkstra-2 --bench 比较各队列的耗时
+ *        不指定队列时根据读图时得到的最大边权自动选择桶队列或基数堆；稠密图（E/V^2 足够大）改用 DenseDijkstra.hpp
+ *        指定终点时，终点出队后立即返回；bidijkstra 在正向图和反向图上同时搜索
+ * @version 1.6
+ * @date 2026-10-17
  * 
  * @copyright Copyright (c) 2024
  * 
  */
 
-#include <bits/stdc++.h>
+#include "DenseDijkstra.hpp"
+#include "DijkstraQueue.hpp"
+#include "GraphFile.hpp"
+#include "GraphGenerator.hpp"
 
-constexpr int MaxN = 1e5;
 constexpr int INF = 0x4fffffff;
 
-struct Edge {
-  int v_{};  // 目标点
-  int w_{};  // 权值
-};
-
-struct Node {
-  int dis_{};  // 源点到目标点的路径长度
-  int u_{};    // 该节点所表示图上的顶点编号
-
-  bool operator>(const Node& x) const { return dis_ > x.dis_; }
-};
-
 int M, N;                   // 顶点数 边数
-int vis[MaxN]{};            // 从源点到目标点的最短路长度是否已知
-int dis[MaxN]{};            // 记录从源点到目标点的最短路长度
-std::vector<Edge> e[MaxN];  // 存储目标点的所有出边
-std::priority_queue<Node, std::vector<Node>, std::greater<Node>> q{};  // 基于路径长度的最小堆
+std::vector<int> vis;       // 从源点到目标点的最短路长度是否已知
+std::vector<int> dis;       // 记录从源点到目标点的最短路长度
+CSRGraph g;                 // 存储所有顶点的出边
+CSRGraph rg;                // 反向图，存储所有顶点的入边，第一次双向搜索时才建立
+int maxW;                   // 最大边权
+long long settled;          // 最近一次搜索确定了最短路的顶点数
+std::unique_ptr<DenseDijkstra> denseSolver;  // 稠密图上使用的邻接矩阵版本
 
 /**
  * @brief dijkstra算法
  *
+ * @tparam Queue 优先队列
  * @param s 起点
- * @param t 终点
+ * @param t 终点，为0时求出所有顶点的最短路
  * @return int 最短路长度
  */
+template <typename Queue>
 int dijkstra(int s, int t) {
   // init
-  for (int i = 1; i <= M; i++) {
-    dis[i] = INF;
-    vis[i] = 0;
-  }
+  dis.assign(M + 1, INF);
+  vis.assign(M + 1, 0);
+  settled = 0;
+  Queue q(M + 1, maxW);
 
   dis[s] = 0;
-  q.emplace(0, s);
+  q.push(s, 0);
   while (!q.empty()) {
-    int u = q.top().u_;
-    q.pop();
-    if (vis[u]) continue;
+    int u = q.pop().second;
+    if (vis[u]) continue;  // 跳过过期元素
     vis[u] = 1;
-    for (const auto edge : e[u]) {  // 遍历顶点u的所有出边
-      int v = edge.v_;
-      int w = edge.w_;
+    settled++;
+    if (u == t) break;  // 终点的最短路已经确定
+    for (const auto [v, w] : g.adj(u)) {  // 遍历顶点u的所有出边
       if (dis[v] > dis[u] + w) {  // 松弛
         dis[v] = dis[u] + w;
-        q.emplace(dis[v], v);
+        q.push(v, dis[v]);
       }
     }
   }
   return dis[t];
 }
 
-int main() {
-  std::cin >> M >> N;
-  for (int i = 0; i < N; i++) {
-    int u, v, w;
-    std::cin >> u >> v >> w;
-    e[u].emplace_back(v, w);
+/**
+ * @brief dijkstra算法，稠密图使用邻接矩阵上的向量化版本，否则根据最大边权选择队列
+ *        桶的个数不超过顶点数时使用Dial桶队列，否则使用基数堆
+ *
+ * @param s 起点
+ * @param t 终点
+ * @return int 最短路长度
+ */
+int dijkstra(int s, int t) {
+  if (denseSolver) {
+    const int d = (*denseSolver)(s, t);
+    dis = denseSolver->dis();
+    return d;
+  }
+  if (maxW + 1 <= M) return dijkstra<DialQueue>(s, t);
+  return dijkstra<RadixHeap>(s, t);
+}
+
+/**
+ * @brief 建立反向图 rg，已建立时直接返回，O(V + E)
+ */
+void buildReverse() {
+  if (rg.n() != g.n()) rg = g.reverse();
+}
+
+/**
+ * @brief 双向dijkstra算法
+ *        从起点在正向图上、从终点在反向图上交替扩展距离较小的一侧，
+ *        mu记录经过两侧都到达过的顶点的最短路径，当两侧队首距离之和不小于mu时，不可能再有更短的路径
+ *
+ * @tparam Queue 优先队列，需要提供 top()
+ * @param s 起点
+ * @param t 终点
+ * @return int 最短路长度
+ */
+template <typename Queue = IndexedHeap<4>>
+int bidijkstra(int s, int t) {
+  buildReverse();
+  std::vector<int> disb(M + 1, INF);  // 反向搜索中各顶点到终点的距离
+  std::vector<int> visb(M + 1, 0);
+  dis.assign(M + 1, INF);
+  vis.assign(M + 1, 0);
+  settled = 0;
+  if (s == t) return 0;
+
+  Queue qf(M + 1, maxW), qb(M + 1, maxW);
+  dis[s] = 0;
+  disb[t] = 0;
+  qf.push(s, 0);
+  qb.push(t, 0);
+  int mu = INF;
+  while (!qf.empty() && !qb.empty()) {
+    if (qf.top().first + qb.top().first >= mu) break;
+    const bool forward = qf.top().first <= qb.top().first;
+    Queue& q = forward ? qf : qb;
+    std::vector<int>& d = forward ? dis : disb;
+    std::vector<int>& v1 = forward ? vis : visb;
+    const std::vector<int>& d2 = forward ? disb : dis;
+    const CSRGraph& graph = forward ? g : rg;
+
+    const int u = q.pop().second;
+    if (v1[u]) continue;  // 跳过过期元素
+    v1[u] = 1;
+    settled++;
+    for (const auto [v, w] : graph.adj(u)) {
+      if (d[v] > d[u] + w) {  // 松弛
+        d[v] = d[u] + w;
+        q.push(v, d[v]);
+      }
+      if (d2[v] < INF) mu = std::min(mu, d[u] + w + d2[v]);
+    }
+  }
+  return mu;
+}
+
+/**
+ * @brief 读图后计算最大边权，稠密图还要建立邻接矩阵；反向图只在需要时由 buildReverse 建立，
+ *        所以映射二进制图文件后只做一次 O(E) 的扫描，不拷贝邻接表
+ */
+void load(const CSRGraph& graph) {
+  g = graph;
+  rg = CSRGraph();
+  M = g.n() - 1;
+  maxW = 0;
+  for (int64_t i = 0; i < g.m(); i++) maxW = std::max(maxW, g.arcs()[i].w_);
+  denseSolver = dense::prefer(g) ? std::make_unique<DenseDijkstra>(g) : nullptr;
+}
+
+/* -------------------------------------------- 基准测试 -------------------------------------------- */
+template <typename Queue>
+void bench(const char* name, const int runs) {
+  std::mt19937 gen(20241124);
+  long long checksum{};
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) {
+    const int s = gen() % M + 1;
+    dijkstra<Queue>(s, 0);
+    for (int v = 1; v <= M; v++) checksum += dis[v] < INF ? dis[v] : 0;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  printf("  %-16s %9.2f ms/run  checksum=%lld\n", name,
+         std::chrono::duration<double, std::milli>(end - start).count() / runs, checksum);
+}
+
+void bench() {
+  const std::vector<std::pair<const char*, CSRGraph>> graphs = {
+      {"grid 1000x1000 w<=100", graph_gen::grid(1000, 1000, 100)},
+      {"random 1e6/8e6 w<=100", graph_gen::random(1000000, 8000000, 100)},
+      {"power-law 1e6/8e6 w<=100", graph_gen::powerLaw(1000000, 8000000, 100)},
+      {"random 1e6/8e6 w<=1e6", graph_gen::random(1000000, 8000000, 1000000)},
+  };
+  for (const auto& [name, graph] : graphs) {
+    load(graph);
+    printf("%s\n", name);
+    bench<LazyQueue>("LazyQueue", 3);
+    bench<IndexedHeap<2>>("IndexedHeap<2>", 3);
+    bench<IndexedHeap<4>>("IndexedHeap<4>", 3);
+    bench<IndexedHeap<8>>("IndexedHeap<8>", 3);
+    bench<RadixHeap>("RadixHeap", 3);
+    bench<DialQueue>("DialQueue", 3);
+  }
+
+  // 点对点查询：完整搜索、终点出队即停止、双向搜索三者确定的顶点数与耗时
+  load(graph_gen::grid(1000, 1000, 100));
+  buildReverse();  // 不计入双向搜索的耗时
+  printf("grid 1000x1000 point-to-point, 100 random pairs\n");
+  const auto p2p = [](const char* name, auto f) {
+    std::mt19937 gen(20241124);
+    long long total{}, checksum{};
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; i++) {
+      const int s = gen() % M + 1;
+      const int t = gen() % M + 1;
+      checksum += f(s, t);
+      total += settled;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    printf("  %-16s %9.2f ms/query  %9lld settled/query  checksum=%lld\n", name,
+           std::chrono::duration<double, std::milli>(end - start).count() / 100, total / 100,
+           checksum);
+  };
+  p2p("full", [](int s, int t) { return dijkstra<IndexedHeap<4>>(s, 0), dis[t]; });
+  p2p("early-exit", [](int s, int t) { return dijkstra<IndexedHeap<4>>(s, t); });
+  p2p("bidirectional", [](int s, int t) { return bidijkstra(s, t); });
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    bench();
+    return 0;
+  }
+  if (argc > 1) {
+    load(graph_file::map(argv[1]));
+  } else {
+    std::cin >> M >> N;
+    load(CSRGraph::read(std::cin, M + 1, N));
   }
 
   std::cout << dijkstra(1, M) << std::endl;
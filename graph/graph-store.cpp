@@ -2,28 +2,37 @@
  * @file graph-store.cpp
  * @author LyBin (lybin1336258176@outlook.com)
  * @brief 图的存储
- * @version 0.2
- * @date 2024-11-15
+ *        graph-store < input        输入 n m 与m条边 u v w，按顶点输出出边，同一顶点的出边按输入的倒序输出
+ *        graph-store file           把文件映射到内存后多线程解析，输出同上
+ *        graph-store --star < input 用链式前向星（s1）读入并输出，结果同上
+ *        graph-store --bench        比较链式前向星、单线程 CSRGraph::read 与多线程 GraphLoader.hpp 读入同一段文本的耗时
+ * @version 0.4
+ * @date 2026-10-17
  * 
  * @copyright Copyright (c) 2024
  * 
  */
 
-#include <bits/stdc++.h>
+#include "GraphLoader.hpp"
 
 /* -------------------------------------------- 链式前向星 ------------------------------------------- */
 namespace s1 {
-const int MaxN = 1e4 + 10;
-
 struct Edge {
   int to;    // 指向的节点
   int w;     // 权重
   int next;  // 该边起点的上一跳边
 };
 
-Edge e[MaxN];      // 边集
-int head[MaxN]{};  // head[i]表示节点i的最后一个边序号
-int cnt{1};        // 记录边数，边序号从1开始
+std::vector<Edge> e;    // 边集，e[0]不使用
+std::vector<int> head;  // head[i]表示节点i的最后一个边序号
+int cnt{1};             // 记录边数，边序号从1开始
+
+// 按实际的点数、边数分配空间，n个点 m条边
+void init(int n, int m) {
+  e.assign(m + 1, {});
+  head.assign(n + 1, 0);
+  cnt = 1;
+}
 
 void addEdge(int u, int v, int w) {
   e[cnt].to = v;
@@ -31,25 +40,109 @@ void addEdge(int u, int v, int w) {
   e[cnt].next = head[u];
   head[u] = cnt++;
 }
-};  // namespace s1
 
-int main() {
+// 读入 n m 与m条边
+void read(std::istream& in) {
   int n, m;  // n个点 m条边
-  std::cin >> n >> m;
+  in >> n >> m;
+  init(n, m);
   for (int i = 0; i < m; i++) {
     int u, v, w;
-    std::cin >> u >> v >> w;
-    s1::addEdge(u, v, w);
+    in >> u >> v >> w;
+    addEdge(u, v, w);
+  }
+}
+
+// 链式前向星遍历图
+void print() {
+  for (int i = 1; i < static_cast<int>(head.size()); i++) {
+    printf("node-%d\n", i);
+    for (int j = head[i]; j != 0; j = e[j].next) {
+      printf("  %d->%d %d\n", i, e[j].to, e[j].w);
+    }
+    std::cout << std::endl;
+  }
+}
+};  // namespace s1
+
+/* ----------------------------------------- 压缩稀疏行(CSR) ----------------------------------------- */
+// 见 CSRGraph.hpp：出边按起点连续存放，遍历时不需要沿next指针跳转，内存按实际点数、边数分配
+// 见 GraphLoader.hpp：多线程解析文本，按线程的出度直方图求前缀和后并行写入出边
+
+inline double elapsed(const std::chrono::steady_clock::time_point& start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void bench() {
+  constexpr int n = 2000000, m = 20000000;
+  std::mt19937 gen(20241124);
+  std::string text = std::to_string(n) + ' ' + std::to_string(m) + '\n';
+  text.reserve(m * 20);
+  for (int i = 0; i < m; i++) {
+    const int u = gen() % n + 1, v = gen() % n + 1, w = gen() % 100 + 1;
+    (((text += std::to_string(u)) += ' ') += std::to_string(v)) += ' ';
+    (text += std::to_string(w)) += '\n';
+  }
+  printf("%d vertices, %d edges, %.1f MB of text\n", n, m, text.size() / 1e6);
+
+  auto start = std::chrono::steady_clock::now();
+  std::istringstream star(text);
+  s1::read(star);
+  printf("  forward star (s1)   %9.1f ms\n", elapsed(start));
+
+  start = std::chrono::steady_clock::now();
+  std::istringstream in(text);
+  int M, N;
+  in >> M >> N;
+  const CSRGraph base = CSRGraph::read(in, M + 1, N);
+  printf("  CSRGraph::read      %9.1f ms\n", elapsed(start));
+  bool same = static_cast<int>(s1::head.size()) == base.n();  // 前向星按输入的倒序保存出边
+  for (int u = 1; same && u < base.n(); u++) {
+    int j = s1::head[u];
+    for (const auto [v, w] : base.adj(u) | std::views::reverse) {
+      same &= j != 0 && s1::e[j].to == v && s1::e[j].w == w;
+      if (j != 0) j = s1::e[j].next;
+    }
+    same &= j == 0;
   }
+  if (!same) printf("  forward star MISMATCH\n");
 
-  // 链式前向星遍历图
+  const int hw = std::max(1u, std::thread::hardware_concurrency());
+  for (int threads = 1; threads <= std::max(4, hw); threads *= 2) {
+    start = std::chrono::steady_clock::now();
+    const CSRGraph g = graph_load::parse(text, threads);
+    const double t = elapsed(start);
+    bool ok = g.n() == base.n() && g.m() == base.m();
+    for (int u = 0; ok && u < g.n(); u++) {
+      const auto a = g.adj(u), b = base.adj(u);
+      ok = std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                      [](const auto& x, const auto& y) { return x.v_ == y.v_ && x.w_ == y.w_; });
+    }
+    printf("  %2d threads          %9.1f ms%s\n", threads, t, ok ? "" : "  MISMATCH");
+  }
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::string(argv[1]) == "--bench") {
+    bench();
+    return 0;
+  }
+  if (argc > 1 && std::string(argv[1]) == "--star") {
+    s1::read(std::cin);
+    s1::print();
+    return 0;
+  }
+  const CSRGraph g = argc > 1 ? graph_load::file(argv[1]) : graph_load::read(std::cin);
+  const int n = g.n() - 1;  // n个点
+
+  // CSR遍历图，倒序遍历出边，与链式前向星一样先输出后加入的边
   for (int i = 1; i <= n; i++) {
     printf("node-%d\n", i);
-    for (int j = s1::head[i]; j != 0; j = s1::e[j].next) {
-      printf("  %d->%d %d\n", i, s1::e[j].to, s1::e[j].w);
+    for (const auto [v, w] : g.adj(i) | std::views::reverse) {
+      printf("  %d->%d %d\n", i, v, w);
     }
     std::cout << std::endl;
   }
 
   return 0;
-}
\ No newline at end of file
+}